@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <cstdint>
+#include "arena.h"
+
+namespace polygonpoint {
+
+Arena::Arena(size_t initial_size) : min_block_size(initial_size) {
+    blocks.reserve(16);
+}
+
+Arena::~Arena() {
+    for (const Block& block : blocks) {
+        ::operator delete(block.data);
+    }
+}
+
+void Arena::add_block(size_t size) {
+    Block block;
+    block.data = static_cast<char*>(::operator new(size));
+    block.size = size;
+    blocks.push_back(block);
+}
+
+/**
+ * entrega size bytes alinhados a alignment (potencia de 2)
+ *
+ * tenta o bloco atual, depois os blocos seguintes ja reservados; so entao reserva
+ * um bloco novo, com pelo menos o dobro do ultimo, para manter poucos blocos.
+ */
+void* Arena::allocate(size_t size, size_t alignment) {
+    while (current < blocks.size()) {
+        Block& block = blocks[current];
+        uintptr_t base = reinterpret_cast<uintptr_t>(block.data);
+        size_t aligned = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+
+        if (aligned + size <= block.size) {
+            offset = aligned + size;
+            in_use = passed + offset;
+            peak = std::max(peak, in_use);
+            return block.data + aligned;
+        }
+
+        // o final do bloco fica sem uso ate o reset, e conta como ocupado
+        passed += block.size;
+        ++current;
+        offset = 0;
+    }
+
+    size_t last = blocks.empty() ? 0 : blocks.back().size;
+    add_block(std::max(std::max(min_block_size, 2 * last), size + alignment));
+    current = blocks.size() - 1;
+    offset = 0;
+    return allocate(size, alignment);
+}
+
+void Arena::reset() {
+    if (blocks.size() > 1) {
+        size_t total = capacity();
+        for (const Block& block : blocks) {
+            ::operator delete(block.data);
+        }
+        blocks.clear();
+        add_block(total);
+    }
+
+    current = 0;
+    offset = 0;
+    passed = 0;
+    in_use = 0;
+}
+
+size_t Arena::capacity() const {
+    size_t total = 0;
+    for (const Block& block : blocks) {
+        total += block.size;
+    }
+    return total;
+}
+
+} // namespace polygonpoint
@@ -0,0 +1,99 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace polygonpoint {
+
+// alocador monotonico: reserva blocos grandes e entrega pedacos sequenciais.
+// nao ha liberacao individual; reset() descarta tudo de uma vez e mantem a memoria
+// para o proximo lote, de modo que lotes de tamanho estavel nao tocam o heap.
+class Arena {
+private:
+    struct Block {
+        char* data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    size_t current = 0;     // bloco em uso
+    size_t offset = 0;      // proximo byte livre no bloco em uso
+    size_t passed = 0;      // bytes dos blocos anteriores ao atual, inclusive sobras nao usadas
+    size_t in_use = 0;      // bytes ocupados desde o ultimo reset (passed + offset)
+    size_t peak = 0;        // maior in_use desde a criacao
+    size_t min_block_size;
+
+    void add_block(size_t size);
+
+public:
+    explicit Arena(size_t initial_size = 64 * 1024);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(size_t size, size_t alignment);
+
+    // libera tudo; se o lote precisou de varios blocos, eles sao trocados por um
+    // unico bloco do tamanho total, para que o proximo lote caiba sem alocar
+    void reset();
+
+    // uso real dos blocos: inclui o alinhamento e o final de blocos que nao couberam
+    // um pedido, nao apenas os bytes pedidos
+    size_t used() const { return in_use; }
+    size_t high_water() const { return peak; }
+    size_t capacity() const;
+    size_t block_count() const { return blocks.size(); }
+};
+
+// alocador STL sobre uma Arena; sem arena, usa o heap normalmente
+template <typename T>
+struct ArenaAllocator {
+    typedef T value_type;
+
+    // os containers levam a arena junto ao serem movidos ou copiados
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    Arena* arena;
+
+    ArenaAllocator(Arena* a = nullptr) : arena(a) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t n) {
+        if (arena) {
+            return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    // memoria da arena so volta no reset
+    void deallocate(T* p, size_t) {
+        if (!arena) {
+            ::operator delete(p);
+        }
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena == b.arena;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena != b.arena;
+}
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+} // namespace polygonpoint
+
+#endif // ARENA_H
@@ -11,6 +11,8 @@
 #include <array>
 #include <memory>
 
+using namespace polygonpoint;
+
 // Estrutura para representar limites de dados
 struct DataBounds {
     long long min_x = std::numeric_limits<long long>::max();
@@ -180,6 +182,12 @@ public:
         }
     }
     
+    // Adiciona um furo ao plot: preenchimento branco opaco (apaga a cor do polígono) e borda preta
+    void addHole() {
+        addPlotItem("'-' with filledcurves closed fs solid 1.0 noborder lc rgb 'white' notitle");
+        addPlotItem("'-' with lines lw 1.5 lc rgb 'black' notitle");
+    }
+    
     // Adiciona rótulos ao plot
     void addLabels(const std::string& style) {
         addPlotItem("'-' with labels " + style + " notitle");
@@ -276,6 +284,13 @@ void draw(const std::vector<Polygon>* polygons, const std::vector<Point>* points
             if (vertexCount > 0) { // Desenhar mesmo polígonos "abertos" com poucos vértices
                 script.addPolygon(poly.id, idx, vertexCount);
                 idx++;
+                
+                // Furos são desenhados logo depois do contorno, por cima dele
+                for (const auto& hole : poly.holes) {
+                    if (hole.size() >= 3) {
+                        script.addHole();
+                    }
+                }
             }
         }
     }
@@ -312,6 +327,14 @@ void draw(const std::vector<Polygon>* polygons, const std::vector<Point>* points
                 if (vertexCount >= 3) {
                     script.writePolygonPoints(poly.vertices);
                 }
+                
+                // Preenchimento e borda de cada furo
+                for (const auto& hole : poly.holes) {
+                    if (hole.size() >= 3) {
+                        script.writePolygonPoints(hole);
+                        script.writePolygonPoints(hole);
+                    }
+                }
             }
         }
     }
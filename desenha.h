@@ -6,6 +6,6 @@
 
 // Funcao para desenhar poligonos e pontos usando gnuplot
 // Recebe ponteiros para os vetores de poligonos e pontos
-void draw(const std::vector<Polygon>* polygons, const std::vector<Point>* points);
+void draw(const std::vector<polygonpoint::Polygon>* polygons, const std::vector<polygonpoint::Point>* points);
 
 #endif // DESENHA_H 
\ No newline at end of file
@@ -0,0 +1,259 @@
+#include <algorithm>
+#include "baseline.h"
+
+// nao alterar: copia do commit "baseline", referencia do teste diferencial; a unica
+// mudanca e qualificar as chamadas com baseline:: para nao colidir com o motor via ADL
+namespace baseline {
+
+/**
+ * calcula a orientacao entre 3 pontos (p, q, r)
+ *
+ * @param p, q, r  pontos
+ * @return COLINEAR || ANTIHORARIO || HORARIO
+ */
+Orientation orientation(Point p, Point q, Point r) {
+    // cross product 2D
+    long long val = (q.y - p.y) * (r.x - q.x) - (q.x - p.x) * (r.y - q.y);
+
+    if (val == 0) return Orientation::COLINEAR; // colinear
+
+    return (val > 0) ? Orientation::ANTIHORARIO : Orientation::HORARIO;
+}
+
+// verifica se o ponto q esta no segmento pr (assumindo colinearidade)
+bool on_segment(Point p, Point q, Point r) {
+    return (q.x <= std::max(p.x, r.x) && q.x >= std::min(p.x, r.x) &&
+            q.y <= std::max(p.y, r.y) && q.y >= std::min(p.y, r.y));
+}
+
+/**
+ * verifica se dois segmentos de reta se intersectam.
+ *
+ * @param p1 primeiro ponto do primeiro segmento
+ * @param q1 segundo ponto do primeiro segmento
+ * @param p2 primeiro ponto do segundo segmento
+ * @param q2 segundo ponto do segundo segmento
+ * @return boolean << se os segmentos se intersectam
+ */
+bool do_intersect(const Point& p1, const Point& q1, const Point& p2, const Point& q2) {
+    // verificar as 4 orientacoes necessarias
+    Orientation o1 = baseline::orientation(p1, q1, p2);
+    Orientation o2 = baseline::orientation(p1, q1, q2);
+    Orientation o3 = baseline::orientation(p2, q2, p1);
+    Orientation o4 = baseline::orientation(p2, q2, q1);
+    
+    // caso geral: se para cada segmento os dois pontos do outro segmento estao em sentidos opostos os segmentos se cruzam
+    if (o1 != o2 && o3 != o4) {
+        return true;
+    }
+    
+    // casos especiais: se um ponto tem orientacao colinear com o segmento, checamos se esta dentro dos "limites" do segmento 
+    if (o1 == Orientation::COLINEAR && baseline::on_segment(p1, p2, q1)) return true;
+    if (o2 == Orientation::COLINEAR && baseline::on_segment(p1, q2, q1)) return true;
+    if (o3 == Orientation::COLINEAR && baseline::on_segment(p2, p1, q2)) return true;
+    if (o4 == Orientation::COLINEAR && baseline::on_segment(p2, q1, q2)) return true;
+    
+    return false;
+}
+
+
+/**
+ * verifica se um poligono e simples (sem auto-intersecoes)
+ * um poligono e considerado simples se:
+ * 1. tem pelo menos 3 vertices
+ * 2. nao possui arestas nao-adjacentes que se interceptam
+ */
+bool is_simple(const Polygon& poly) {
+    int n = poly.vertices.size();
+    
+    if (n < 3) {
+        return false; // poligonos com menos de 3 vertices nao sao simples por definicao
+    }
+
+    // verifica se ha intersecoes entre arestas nao-adjacentes
+    for (int i = 0; i < n; ++i) {
+        Point p1 = poly.vertices[i];
+        Point q1 = poly.vertices[(i + 1) % n]; // proximo vertice (% usa vetor como anel)
+
+        // verificar contra todas as outras arestas nao-adjacentes
+        for (int j = i + 2; j < n; ++j) {
+
+            if ((j + 1) % n == i) {
+                continue; // arestas adjacentes (ultima e primeira)
+            }
+
+            Point p2 = poly.vertices[j];
+            Point q2 = poly.vertices[(j + 1) % n];
+
+            // verificar interseccao
+            if (baseline::do_intersect(p1, q1, p2, q2)) {
+                return false; // encontrada interseccao entre arestas nao-adjacentes
+            }
+        }
+    }
+
+    return true; // nenhuma interseccao encontrada
+}
+
+/**
+ * verifica se um poligono simples e convexo
+ * um poligono e convexo se todos os angulos internos sao menores ou iguais a 180 graus.
+ * matematicamente, isso significa que todas as "viradas" devem ser na mesma direcao.
+ */
+bool is_convex(const Polygon& poly) {
+    int n = poly.vertices.size();
+    
+    // verificacoes preliminares
+    if (n < 3) {
+        return false; // nao e um poligono valido
+    }
+    
+    // para um poligono ser convexo, todas as orientacoes entre 3 pontos sequenciais devem ser a mesma
+    // primeiro, encontra a primeira orientacao nao-colinear para usar como referencia
+    Orientation reference_orientation = Orientation::COLINEAR;
+    bool has_orientation = false;
+    
+    // encontrar a primeira orientacao nao-colinear
+    for (int i = 0; i < n && !has_orientation; ++i) {
+        Point p1 = poly.vertices[i];
+        Point p2 = poly.vertices[(i + 1) % n];
+        Point p3 = poly.vertices[(i + 2) % n];
+        
+        Orientation orient = baseline::orientation(p1, p2, p3);
+        if (orient != Orientation::COLINEAR) {
+            reference_orientation = orient;
+            has_orientation = true;
+        }
+    }
+    
+    // se todos os pontos sao colineares, consideramos convexo (e um segmento de reta)
+    if (!has_orientation) {
+        return true;
+    }
+    
+    // agora verificamos se todas as orientacoes sao iguais a referencia ou colineares
+    for (int i = 0; i < n; ++i) {
+        Point p1 = poly.vertices[i];
+        Point p2 = poly.vertices[(i + 1) % n];
+        Point p3 = poly.vertices[(i + 2) % n];
+        
+        Orientation orient = baseline::orientation(p1, p2, p3);
+        
+        // se encontrarmos uma orientacao diferente da referencia e nao-colinear, nao e convexo
+        if (orient != Orientation::COLINEAR && orient != reference_orientation) {
+            return false;
+        }
+    }
+    
+    return true; // todas as orientacoes sao consistentes, o poligono e convexo
+}
+
+
+/**
+ * verifica se um ponto esta dentro de um poligono simples
+ * 
+ * implementa o algoritmo de ray casting (parity method):
+ * - traca um raio horizontal a partir do ponto
+ * - conta as intersecoes com as arestas do poligono
+ * - numero impar de intersecoes: ponto esta dentro
+ * - numero par de intersecoes: ponto esta fora
+ * - pontos sobre arestas ou vertices sao considerados dentro
+ *
+ * @param point o ponto a ser verificado
+ * @param polygon o poligono a ser testado
+ * @return true se o ponto estiver dentro ou sobre o poligono, false caso contrario
+ */
+bool is_inside(const Point& point, const Polygon& polygon) {
+    // poligonos nao-simples ou com menos de 3 vertices nao contem pontos
+    if (!polygon.is_simple || polygon.vertices.size() < 3) {
+        return false;
+    }
+
+    const int n = polygon.vertices.size();
+
+    // comecamos com false e vamos invertendo a variavel a cada interseccao encontrada (%2)
+    bool inside = false;
+    
+    // primeiro, verificar se o ponto esta sobre alguma aresta ou vertice
+    for (int i = 0; i < n; i++) {
+        const Point& current = polygon.vertices[i];
+        const Point& next = polygon.vertices[(i + 1) % n];
+        
+        // verificar se o ponto esta sobre um vertice
+        if (point.x == current.x && point.y == current.y) {
+            return true;
+        }
+        
+        // verificar se o ponto esta sobre uma aresta
+        if (baseline::orientation(current, point, next) == Orientation::COLINEAR && 
+            baseline::on_segment(current, point, next)) {
+            return true;
+        }
+    }
+    
+    // implementacao do algoritmo ray casting
+    for (int i = 0, j = n - 1; i < n; j = i++) {
+        const Point& vi = polygon.vertices[i];
+        const Point& vj = polygon.vertices[j];
+        
+        // condicao para verificar se a aresta cruza o raio horizontal
+        bool cross_x_ray = (vi.y > point.y) != (vj.y > point.y);
+        
+        // se a aresta nao cruza horizontalmente, pule para a proxima aresta
+        if (!cross_x_ray) continue;
+
+        // a partir daqui, sabemos que o ponto esta no range vertical do segmento
+        
+        // verificar se a interseccao esta a direita do ponto
+        // caso especial: aresta vertical
+        if (vi.x == vj.x) {
+            if (vi.x > point.x) {
+                inside = !inside;
+            }
+            continue;
+        }
+        
+        // caso geral: calcular a interseccao
+        // evitar divisao por zero (embora ja deveria estar garantido por cross_x_ray)
+        if (vj.y - vi.y == 0) continue;
+        
+        // calcular o ponto x onde a aresta cruza o raio horizontal
+        double x_intersect = static_cast<double>(vj.x - vi.x) * (point.y - vi.y) / (vj.y - vi.y) + vi.x;
+        
+        // se a interseccao esta a direita do ponto, inverte o estado
+        if (x_intersect > point.x) {
+            inside = !inside;
+        }
+    }
+    
+    return inside;
+}
+
+/**
+ * classifica os poligonos como simples/nao simples e convexo/nao convexo
+ */
+void classify_polygons(std::vector<Polygon>& polygons) {
+    for (auto& polygon : polygons) {
+        // processamento especial para poligonos com menos de 3 vertices
+        if (polygon.vertices.size() < 3) {
+            polygon.type = PolygonType::NOT_SIMPLE;
+            polygon.is_simple = false;
+            continue;
+        }
+
+        // verificar se o poligono e simples (sem auto-intersecoes)
+        polygon.is_simple = baseline::is_simple(polygon);
+        
+        if (!polygon.is_simple) {
+            polygon.type = PolygonType::NOT_SIMPLE;
+        } else {
+            if (baseline::is_convex(polygon)) {
+                polygon.type = PolygonType::SIMPLE_CONVEX;
+            } else {
+                polygon.type = PolygonType::SIMPLE_NON_CONVEX;
+            }
+        }
+    }
+}
+
+} // namespace baseline
@@ -0,0 +1,30 @@
+#ifndef FUZZ_BASELINE_H
+#define FUZZ_BASELINE_H
+
+#include <vector>
+#include "geometry.h"
+
+// copia congelada das funcoes de main.cpp antes dos motores acelerados (commit "baseline").
+// o oracle usa apenas estas funcoes, de modo que mudancas em geometry.cpp aparecem como
+// divergencia em vez de mudarem a referencia junto. os tipos (Point, Polygon) sao os mesmos;
+// is_inside le polygon.is_simple, que deve vir de classify_polygons abaixo.
+namespace baseline {
+
+using polygonpoint::Orientation;
+using polygonpoint::Point;
+using polygonpoint::Polygon;
+using polygonpoint::PolygonType;
+
+Orientation orientation(Point p, Point q, Point r);
+bool on_segment(Point p, Point q, Point r);
+bool do_intersect(const Point& p1, const Point& q1, const Point& p2, const Point& q2);
+bool is_simple(const Polygon& poly);
+bool is_convex(const Polygon& poly);
+bool is_inside(const Point& point, const Polygon& polygon);
+
+// classificacao original, apenas do contorno (furos sao ignorados)
+void classify_polygons(std::vector<Polygon>& polygons);
+
+} // namespace baseline
+
+#endif // FUZZ_BASELINE_H
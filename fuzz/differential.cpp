@@ -0,0 +1,123 @@
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#include "generators.h"
+#include "oracle.h"
+#include "shrink.h"
+
+// opcoes de linha de comando
+struct Options {
+    long long iterations = 10000;   // --iteracoes
+    unsigned seed = 1;              // --semente
+    std::string reproduce;          // --reproduzir <arquivo do libFuzzer>
+    std::string tests_dir = "tests"; // --testes <diretorio>
+};
+
+bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+
+        if (arg == "--iteracoes" && has_value) {
+            options.iterations = std::stoll(argv[++i]);
+        } else if (arg == "--semente" && has_value) {
+            options.seed = std::stoul(argv[++i]);
+        } else if (arg == "--reproduzir" && has_value) {
+            options.reproduce = argv[++i];
+        } else if (arg == "--testes" && has_value) {
+            options.tests_dir = argv[++i];
+        } else {
+            std::cerr << "Erro: opcao desconhecida ou sem valor '" << arg << "'" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool write_file(const std::string& path, const std::string& content) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Erro: nao foi possivel escrever " << path << std::endl;
+        return false;
+    }
+    file << content;
+    return true;
+}
+
+/**
+ * reduz o caso divergente e salva como caso de teste: tests/in/<nome>.txt com a entrada,
+ * tests/out/<nome>.txt com a saida da implementacao de referencia e, se o motor precisar
+ * de opcoes, tests/args/<nome>.txt. assim o make test falha ate a divergencia ser corrigida.
+ */
+static void save_repro(const FuzzCase& fuzz_case, const Mismatch& mismatch,
+                       const std::string& name, const std::string& tests_dir) {
+    FuzzCase minimal = shrink_case(fuzz_case, mismatch.kind);
+    std::string detail = check_kind(minimal, mismatch.kind);
+    std::string file = name + ".txt";
+
+    std::cout << "divergencia (" << mismatch_kind_to_string(mismatch.kind) << "): " << detail << std::endl;
+    std::cout << case_to_input(minimal);
+
+    bool saved = write_file(tests_dir + "/in/" + file, case_to_input(minimal)) &&
+                 write_file(tests_dir + "/out/" + file, expected_output(minimal, mismatch.kind));
+
+    std::string args = mismatch_args(minimal, mismatch.kind);
+    if (saved && !args.empty()) {
+        saved = write_file(tests_dir + "/args/" + file, args + "\n");
+    }
+
+    if (saved) {
+        std::cout << "caso minimo salvo em " << tests_dir << "/in/" << file << std::endl;
+    }
+}
+
+// reduz e salva uma entrada gravada pelo libFuzzer
+static int reproduce(const Options& options) {
+    std::ifstream file(options.reproduce, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Erro: nao foi possivel abrir " << options.reproduce << std::endl;
+        return 1;
+    }
+
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    FuzzCase fuzz_case = decode_case(data.data(), data.size());
+    Mismatch mismatch = check_case(fuzz_case);
+
+    if (mismatch.kind == MismatchKind::NONE) {
+        std::cout << "nenhuma divergencia" << std::endl;
+        return 0;
+    }
+
+    save_repro(fuzz_case, mismatch, "fuzz-reproducao", options.tests_dir);
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        return 1;
+    }
+
+    if (!options.reproduce.empty()) {
+        return reproduce(options);
+    }
+
+    std::mt19937 rng(options.seed);
+
+    for (long long i = 0; i < options.iterations; ++i) {
+        FuzzCase fuzz_case = random_case(rng);
+        Mismatch mismatch = check_case(fuzz_case);
+
+        if (mismatch.kind != MismatchKind::NONE) {
+            std::string name = "fuzz-" + std::to_string(options.seed) + "-" + std::to_string(i);
+            save_repro(fuzz_case, mismatch, name, options.tests_dir);
+            return 1;
+        }
+    }
+
+    std::cout << options.iterations << " casos sem divergencia (semente " << options.seed << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,22 @@
+// alvo do libFuzzer: decodifica os bytes num caso pequeno e compara os motores
+// acelerados com a implementacao de referencia. qualquer divergencia aborta,
+// e o libFuzzer grava a entrada; use ./diferencial --reproduzir <arquivo> para
+// reduzi-la e salva-la em tests/in.
+#include <cstdio>
+#include <cstdlib>
+#include "oracle.h"
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    FuzzCase fuzz_case = decode_case(data, size);
+    Mismatch mismatch = check_case(fuzz_case);
+
+    if (mismatch.kind != MismatchKind::NONE) {
+        std::fprintf(stderr, "divergencia (%s): %s\n%s",
+                     mismatch_kind_to_string(mismatch.kind).c_str(),
+                     mismatch.detail.c_str(),
+                     case_to_input(fuzz_case).c_str());
+        std::abort();
+    }
+
+    return 0;
+}
@@ -0,0 +1,364 @@
+#include <algorithm>
+#include <sstream>
+#include "generators.h"
+
+using namespace polygonpoint;
+
+void finalize_case(FuzzCase& fuzz_case) {
+    for (size_t i = 0; i < fuzz_case.polygons.size(); ++i) {
+        fuzz_case.polygons[i].id = i + 1;
+    }
+    classify_polygons(fuzz_case.polygons);
+}
+
+// inteiro uniforme em [lo, hi]
+static long long uniform(std::mt19937& rng, long long lo, long long hi) {
+    return std::uniform_int_distribution<long long>(lo, hi)(rng);
+}
+
+static Point random_point(std::mt19937& rng, long long range) {
+    return {uniform(rng, -range, range), uniform(rng, -range, range)};
+}
+
+// pontos "perigosos" derivados dos poligonos: vertices (do contorno ou dos furos), pontos
+// inteiros sobre arestas e pontos na mesma horizontal de um vertice (limites do ray casting)
+static Point tricky_point(std::mt19937& rng, const std::vector<Polygon>& polygons, long long range) {
+    const Polygon& polygon = polygons[uniform(rng, 0, polygons.size() - 1)];
+
+    // contorno ou um dos furos
+    const int ring_index = uniform(rng, 0, polygon.holes.size());
+    const std::vector<Point>& ring = (ring_index == 0) ? polygon.vertices : polygon.holes[ring_index - 1];
+    if (ring.empty()) {
+        return random_point(rng, range);
+    }
+
+    const int n = ring.size();
+    const Point& a = ring[uniform(rng, 0, n - 1)];
+    const Point& b = ring[uniform(rng, 0, n - 1)];
+
+    switch (uniform(rng, 0, 2)) {
+        case 0:
+            return a;
+        case 1:
+            // ponto medio, inteiro quando as somas sao pares; senao cai no vertice
+            if ((a.x + b.x) % 2 == 0 && (a.y + b.y) % 2 == 0) {
+                return {(a.x + b.x) / 2, (a.y + b.y) / 2};
+            }
+            return b;
+        default:
+            return {a.x + uniform(rng, -range, range), a.y};
+    }
+}
+
+static void add_points(std::mt19937& rng, FuzzCase& fuzz_case, long long range) {
+    const int count = uniform(rng, 1, 12);
+    for (int i = 0; i < count; ++i) {
+        bool tricky = !fuzz_case.polygons.empty() && uniform(rng, 0, 1) == 0;
+        fuzz_case.points.push_back(tricky ? tricky_point(rng, fuzz_case.polygons, range)
+                                          : random_point(rng, range));
+    }
+}
+
+FuzzCase random_general_case(std::mt19937& rng) {
+    static const long long ranges[] = {4, 20, 1000, 1000000};
+    const long long range = ranges[uniform(rng, 0, 3)];
+
+    FuzzCase fuzz_case;
+    const int m = uniform(rng, 1, 6);
+    for (int i = 0; i < m; ++i) {
+        Polygon polygon = Polygon(); // zera id, type e is_simple ate finalize_case
+        const int n = uniform(rng, 3, 8);
+        for (int j = 0; j < n; ++j) {
+            polygon.vertices.push_back(random_point(rng, range));
+        }
+        fuzz_case.polygons.push_back(polygon);
+    }
+
+    add_points(rng, fuzz_case, range);
+    finalize_case(fuzz_case);
+    return fuzz_case;
+}
+
+FuzzCase random_degenerate_case(std::mt19937& rng) {
+    const long long range = 3;
+
+    FuzzCase fuzz_case;
+    const int m = uniform(rng, 1, 5);
+    for (int i = 0; i < m; ++i) {
+        Polygon polygon = Polygon(); // zera id, type e is_simple ate finalize_case
+
+        switch (uniform(rng, 0, 3)) {
+            case 0: {
+                // todos os vertices sobre uma reta
+                Point origin = random_point(rng, range);
+                Point step = {uniform(rng, -1, 1), uniform(rng, -1, 1)};
+                const int n = uniform(rng, 3, 6);
+                for (int j = 0; j < n; ++j) {
+                    long long k = uniform(rng, -2, 2);
+                    polygon.vertices.push_back({origin.x + k * step.x, origin.y + k * step.y});
+                }
+                break;
+            }
+            case 1: {
+                // 1 ou 2 vertices
+                const int n = uniform(rng, 1, 2);
+                for (int j = 0; j < n; ++j) {
+                    polygon.vertices.push_back(random_point(rng, range));
+                }
+                break;
+            }
+            default: {
+                // grade minuscula, com chance de repetir o vertice anterior
+                const int n = uniform(rng, 3, 7);
+                for (int j = 0; j < n; ++j) {
+                    if (j > 0 && uniform(rng, 0, 4) == 0) {
+                        polygon.vertices.push_back(polygon.vertices.back());
+                    } else {
+                        polygon.vertices.push_back(random_point(rng, range));
+                    }
+                }
+                break;
+            }
+        }
+
+        fuzz_case.polygons.push_back(polygon);
+    }
+
+    add_points(rng, fuzz_case, range);
+    finalize_case(fuzz_case);
+    return fuzz_case;
+}
+
+FuzzCase random_nested_case(std::mt19937& rng) {
+    FuzzCase fuzz_case;
+
+    // cada retangulo fica estritamente dentro do anterior ou a direita de todos, sem tocar
+    long long x0 = 0, y0 = 0, x1 = 200, y1 = 200;
+    long long right = x1;
+    const int m = uniform(rng, 1, 6);
+    for (int i = 0; i < m; ++i) {
+        if (i > 0) {
+            long long w = x1 - x0, h = y1 - y0;
+            if (w < 8 || h < 8 || uniform(rng, 0, 2) == 0) {
+                x0 = right + uniform(rng, 1, 5);
+                x1 = x0 + uniform(rng, 10, 200);
+                y0 = uniform(rng, -50, 50);
+                y1 = y0 + uniform(rng, 10, 200);
+            } else {
+                x0 += uniform(rng, 1, w / 4);
+                x1 -= uniform(rng, 1, w / 4);
+                y0 += uniform(rng, 1, h / 4);
+                y1 -= uniform(rng, 1, h / 4);
+            }
+            right = std::max(right, x1);
+        }
+
+        Polygon polygon = Polygon(); // zera id, type e is_simple ate finalize_case
+        polygon.vertices = {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}};
+        fuzz_case.polygons.push_back(polygon);
+    }
+
+    // retangulos em ordem aleatoria, para exercitar a ordenacao por area
+    std::shuffle(fuzz_case.polygons.begin(), fuzz_case.polygons.end(), rng);
+
+    add_points(rng, fuzz_case, 400);
+    finalize_case(fuzz_case);
+    return fuzz_case;
+}
+
+// retangulo com cantos (x0, y0) e (x1, y1)
+static std::vector<Point> rectangle(long long x0, long long y0, long long x1, long long y1) {
+    return {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}};
+}
+
+FuzzCase random_holed_case(std::mt19937& rng) {
+    const long long grid = 12;
+
+    FuzzCase fuzz_case;
+    const int m = uniform(rng, 1, 4);
+    for (int i = 0; i < m; ++i) {
+        Polygon polygon = Polygon(); // zera id, type e is_simple ate finalize_case
+
+        // metade das vezes, um retangulo derivado de um furo anterior: ilha dentro do furo,
+        // retangulo que toca o furo ou que o cobre, conforme a margem sorteada
+        const Polygon& previous = fuzz_case.polygons.empty() ? polygon :
+            fuzz_case.polygons[uniform(rng, 0, fuzz_case.polygons.size() - 1)];
+        if (!previous.holes.empty() && uniform(rng, 0, 1) == 0) {
+            const auto& hole = previous.holes[uniform(rng, 0, previous.holes.size() - 1)];
+            BoundingBox box = ring_bounds(hole);
+            long long margin = uniform(rng, -1, 2);
+            long long x0 = box.min_x - margin, x1 = box.max_x + margin;
+            long long y0 = box.min_y - margin, y1 = box.max_y + margin;
+            if (x0 < x1 && y0 < y1) {
+                polygon.vertices = rectangle(x0, y0, x1, y1);
+                fuzz_case.polygons.push_back(polygon);
+                continue;
+            }
+        }
+
+        long long x0 = uniform(rng, 0, grid - 1), x1 = uniform(rng, x0 + 1, grid);
+        long long y0 = uniform(rng, 0, grid - 1), y1 = uniform(rng, y0 + 1, grid);
+        polygon.vertices = rectangle(x0, y0, x1, y1);
+
+        // um ou dois furos estritamente dentro do contorno (furos que se tocam ou se
+        // sobrepoem invalidam o poligono, o que tambem e um caso util)
+        const int holes = (x1 - x0 >= 3 && y1 - y0 >= 3) ? uniform(rng, 0, 2) : 0;
+        for (int h = 0; h < holes; ++h) {
+            long long hx0 = uniform(rng, x0 + 1, x1 - 2), hx1 = uniform(rng, hx0 + 1, x1 - 1);
+            long long hy0 = uniform(rng, y0 + 1, y1 - 2), hy1 = uniform(rng, hy0 + 1, y1 - 1);
+            polygon.holes.push_back(rectangle(hx0, hy0, hx1, hy1));
+        }
+
+        fuzz_case.polygons.push_back(polygon);
+    }
+
+    add_points(rng, fuzz_case, grid);
+    finalize_case(fuzz_case);
+    return fuzz_case;
+}
+
+FuzzCase random_touching_case(std::mt19937& rng) {
+    const long long grid = 16;
+
+    FuzzCase fuzz_case;
+    const int m = uniform(rng, 1, 5);
+    for (int i = 0; i < m; ++i) {
+        Polygon polygon = Polygon(); // zera id, type e is_simple ate finalize_case
+
+        if (uniform(rng, 0, 2) == 0) {
+            // forma em U: entalhe [xa, xb] x [ya, y1] aberto para cima
+            long long x0 = uniform(rng, 0, grid - 4), x1 = uniform(rng, x0 + 3, grid);
+            long long y0 = uniform(rng, 0, grid - 2), y1 = uniform(rng, y0 + 2, grid);
+            long long xa = uniform(rng, x0 + 1, x1 - 2), xb = uniform(rng, xa + 1, x1 - 1);
+            long long ya = uniform(rng, y0 + 1, y1 - 1);
+            polygon.vertices = {{x0, y0}, {x1, y0}, {x1, y1}, {xb, y1},
+                                {xb, ya}, {xa, ya}, {xa, y1}, {x0, y1}};
+        } else if (!fuzz_case.polygons.empty() && uniform(rng, 0, 3) != 0) {
+            // retangulo dentro da caixa de um poligono anterior, podendo tocar a borda dela
+            const Polygon& parent = fuzz_case.polygons[uniform(rng, 0, fuzz_case.polygons.size() - 1)];
+            BoundingBox box = ring_bounds(parent.vertices);
+            long long x0 = uniform(rng, box.min_x, box.max_x - 1), x1 = uniform(rng, x0 + 1, box.max_x);
+            long long y0 = uniform(rng, box.min_y, box.max_y - 1), y1 = uniform(rng, y0 + 1, box.max_y);
+            polygon.vertices = rectangle(x0, y0, x1, y1);
+        } else {
+            long long x0 = uniform(rng, 0, grid - 1), x1 = uniform(rng, x0 + 1, grid);
+            long long y0 = uniform(rng, 0, grid - 1), y1 = uniform(rng, y0 + 1, grid);
+            polygon.vertices = rectangle(x0, y0, x1, y1);
+        }
+
+        fuzz_case.polygons.push_back(polygon);
+    }
+
+    add_points(rng, fuzz_case, grid);
+    finalize_case(fuzz_case);
+    return fuzz_case;
+}
+
+FuzzCase random_case(std::mt19937& rng) {
+    switch (uniform(rng, 0, 4)) {
+        case 0:
+            return random_general_case(rng);
+        case 1:
+            return random_degenerate_case(rng);
+        case 2:
+            return random_nested_case(rng);
+        case 3:
+            return random_holed_case(rng);
+        default:
+            return random_touching_case(rng);
+    }
+}
+
+// leitor sequencial de bytes; devolve 0 quando os dados acabam
+struct ByteReader {
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+
+    uint8_t next() {
+        return (pos < size) ? data[pos++] : 0;
+    }
+
+    // coordenada pequena em [-8, 7], para favorecer degeneracoes
+    long long coordinate() {
+        return static_cast<long long>(next() % 16) - 8;
+    }
+};
+
+FuzzCase decode_case(const uint8_t* data, size_t size) {
+    ByteReader reader = {data, size, 0};
+    FuzzCase fuzz_case;
+
+    const int m = reader.next() % 6 + 1;
+    for (int i = 0; i < m; ++i) {
+        Polygon polygon = Polygon(); // zera id, type e is_simple ate finalize_case
+        const int n = reader.next() % 8 + 1;
+        for (int j = 0; j < n; ++j) {
+            long long x = reader.coordinate();
+            long long y = reader.coordinate();
+            polygon.vertices.push_back({x, y});
+        }
+
+        // um quarto dos poligonos ganha um furo com ate 4 vertices
+        if (reader.next() % 4 == 0) {
+            std::vector<Point> hole(reader.next() % 4 + 1);
+            for (Point& p : hole) {
+                p.x = reader.coordinate();
+                p.y = reader.coordinate();
+            }
+            polygon.holes.push_back(hole);
+        }
+        fuzz_case.polygons.push_back(polygon);
+    }
+
+    const int count = reader.next() % 16 + 1;
+    for (int i = 0; i < count; ++i) {
+        long long x = reader.coordinate();
+        long long y = reader.coordinate();
+        fuzz_case.points.push_back({x, y});
+    }
+
+    finalize_case(fuzz_case);
+    return fuzz_case;
+}
+
+bool case_has_holes(const FuzzCase& fuzz_case) {
+    for (const Polygon& polygon : fuzz_case.polygons) {
+        if (!polygon.holes.empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void write_ring(std::ostream& out, const std::vector<Point>& ring) {
+    out << ring.size() << "\n";
+    for (const Point& p : ring) {
+        out << p.x << " " << p.y << "\n";
+    }
+}
+
+std::string case_to_input(const FuzzCase& fuzz_case) {
+    const bool holes = case_has_holes(fuzz_case);
+
+    std::ostringstream out;
+    out << fuzz_case.polygons.size() << " " << fuzz_case.points.size() << "\n";
+
+    for (const Polygon& polygon : fuzz_case.polygons) {
+        write_ring(out, polygon.vertices);
+
+        // formato de --furos: numero de furos e um anel por furo
+        if (holes) {
+            out << polygon.holes.size() << "\n";
+            for (const auto& hole : polygon.holes) {
+                write_ring(out, hole);
+            }
+        }
+    }
+
+    for (const Point& p : fuzz_case.points) {
+        out << p.x << " " << p.y << "\n";
+    }
+
+    return out.str();
+}
@@ -0,0 +1,50 @@
+#ifndef FUZZ_GENERATORS_H
+#define FUZZ_GENERATORS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "geometry.h"
+
+// caso de teste: poligonos (com ou sem furos) e pontos, no mesmo formato da entrada padrao
+struct FuzzCase {
+    std::vector<polygonpoint::Polygon> polygons;
+    std::vector<polygonpoint::Point> points;
+};
+
+// reatribui ids (1..m) e classifica os poligonos; chamar apos qualquer alteracao
+void finalize_case(FuzzCase& fuzz_case);
+
+// caso aleatorio, sorteando entre os geradores abaixo
+FuzzCase random_case(std::mt19937& rng);
+
+// coordenadas arbitrarias em faixas pequenas, medias e grandes
+FuzzCase random_general_case(std::mt19937& rng);
+
+// coordenadas degeneradas: grade minuscula, vertices repetidos, arestas colineares,
+// poligonos com 1-2 vertices e pontos sobre vertices, arestas e horizontais de vertices
+FuzzCase random_degenerate_case(std::mt19937& rng);
+
+// retangulos aninhados ou disjuntos (familia laminar), para exercitar a hierarquia
+FuzzCase random_nested_case(std::mt19937& rng);
+
+// retangulos com furos numa grade pequena: ilhas dentro de furos, poligonos que cobrem
+// furos de outros e bordas que se tocam aparecem com frequencia
+FuzzCase random_holed_case(std::mt19937& rng);
+
+// poligonos retilineos (retangulos e formas em U) aninhados com bordas que se tocam,
+// inclusive retangulos encaixados no entalhe de um U, tocando a borda dele por fora
+FuzzCase random_touching_case(std::mt19937& rng);
+
+// decodifica bytes arbitrarios (entrada do libFuzzer) num caso pequeno
+FuzzCase decode_case(const uint8_t* data, size_t size);
+
+// verdadeiro se algum poligono tem furos (a entrada precisa de --furos)
+bool case_has_holes(const FuzzCase& fuzz_case);
+
+// texto no formato de entrada de poligonos (formato de --furos se houver furos)
+std::string case_to_input(const FuzzCase& fuzz_case);
+
+#endif // FUZZ_GENERATORS_H
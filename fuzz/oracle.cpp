@@ -0,0 +1,790 @@
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include "oracle.h"
+#include "baseline.h"
+#include "hierarchy.h"
+#include "relations.h"
+#include "nearest.h"
+
+using namespace polygonpoint;
+
+std::string mismatch_kind_to_string(MismatchKind kind) {
+    switch (kind) {
+        case MismatchKind::NONE:
+            return "nenhuma";
+        case MismatchKind::CLASSIFICATION:
+            return "classificacao";
+        case MismatchKind::CONTAINMENT:
+            return "contencao";
+        case MismatchKind::WINDING:
+            return "nao-zero";
+        case MismatchKind::RELATIONS:
+            return "relacoes";
+        case MismatchKind::NEAREST:
+            return "distancia";
+        case MismatchKind::HIERARCHY:
+            return "hierarquia";
+        default:
+            return "desconhecida";
+    }
+}
+
+static std::string kind_args(MismatchKind kind) {
+    switch (kind) {
+        case MismatchKind::WINDING:
+            return "--nao-zero";
+        case MismatchKind::RELATIONS:
+            return "--relacoes";
+        case MismatchKind::NEAREST:
+            return "--distancia";
+        case MismatchKind::HIERARCHY:
+            return "--hierarquia";
+        default:
+            return "";
+    }
+}
+
+std::string mismatch_args(const FuzzCase& fuzz_case, MismatchKind kind) {
+    std::string args = kind_args(kind);
+    if (case_has_holes(fuzz_case)) {
+        args = args.empty() ? "--furos" : "--furos " + args;
+    }
+    return args;
+}
+
+// ---- implementacao de referencia (forca bruta sobre a copia congelada em baseline.cpp) ----
+
+// aneis do poligono: contorno seguido dos furos
+static std::vector<const std::vector<Point>*> polygon_rings(const Polygon& polygon) {
+    std::vector<const std::vector<Point>*> rings = {&polygon.vertices};
+    for (const auto& hole : polygon.holes) {
+        rings.push_back(&hole);
+    }
+    return rings;
+}
+
+// anel isolado como poligono simples, para aplicar baseline::is_inside a um furo
+static Polygon ring_polygon(const std::vector<Point>& ring) {
+    Polygon polygon = Polygon();
+    polygon.vertices = ring;
+    polygon.is_simple = true;
+    return polygon;
+}
+
+// anel com todas as arestas horizontais ou verticais
+static bool is_rectilinear_ring(const std::vector<Point>& ring) {
+    const int n = ring.size();
+    for (int i = 0; i < n; ++i) {
+        const Point& a = ring[i];
+        const Point& b = ring[(i + 1) % n];
+        if (a.x != b.x && a.y != b.y) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ponto sobre alguma aresta do anel (mesmo teste de borda de baseline::is_inside)
+static bool reference_on_border(const Point& point, const std::vector<Point>& ring) {
+    const int n = ring.size();
+    for (int i = 0; i < n; ++i) {
+        if (baseline::orientation(ring[i], point, ring[(i + 1) % n]) == Orientation::COLINEAR &&
+            baseline::on_segment(ring[i], point, ring[(i + 1) % n])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * ponto estritamente dentro de um furo
+ *
+ * furos retilineos usam a grade dobrada: os quatro vizinhos diagonais a meia unidade tem
+ * coordenadas impares no anel dobrado, nunca sobre a borda, e ficam na mesma celula do
+ * ponto quando ele esta no interior; na borda, algum deles fica fora. os demais furos
+ * descontam a borda com o teste de baseline::is_inside.
+ */
+static bool inside_hole(const Point& point, const std::vector<Point>& hole) {
+    if (!is_rectilinear_ring(hole)) {
+        return !reference_on_border(point, hole) && baseline::is_inside(point, ring_polygon(hole));
+    }
+
+    std::vector<Point> ring2 = hole;
+    for (Point& p : ring2) {
+        p = {2 * p.x, 2 * p.y};
+    }
+    const Polygon hole2 = ring_polygon(ring2);
+
+    static const int offsets[4][2] = {{-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
+    for (const auto& offset : offsets) {
+        Point corner = {2 * point.x + offset[0], 2 * point.y + offset[1]};
+        if (!baseline::is_inside(corner, hole2)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// regiao de um poligono simples: dentro do contorno (is_inside) e fora do interior dos furos
+static bool reference_inside(const Point& point, const Polygon& polygon) {
+    if (!polygon.is_simple || !baseline::is_inside(point, polygon)) {
+        return false;
+    }
+
+    for (const auto& hole : polygon.holes) {
+        if (inside_hole(point, hole)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// algum par de arestas dos dois aneis se toca (baseline::do_intersect)
+static bool reference_rings_touch(const std::vector<Point>& a, const std::vector<Point>& b) {
+    const int na = a.size();
+    const int nb = b.size();
+    for (int i = 0; i < na; ++i) {
+        for (int j = 0; j < nb; ++j) {
+            if (baseline::do_intersect(a[i], a[(i + 1) % na], b[j], b[(j + 1) % nb])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// furos validos: aneis simples, sem contato com o contorno nem entre si, dentro do contorno
+static bool reference_holes_valid(const Polygon& polygon) {
+    for (size_t a = 0; a < polygon.holes.size(); ++a) {
+        const std::vector<Point>& hole = polygon.holes[a];
+        if (hole.size() < 3 || !baseline::is_simple(ring_polygon(hole)) ||
+            !baseline::is_inside(hole[0], polygon) ||
+            reference_rings_touch(hole, polygon.vertices)) {
+            return false;
+        }
+        for (size_t b = a + 1; b < polygon.holes.size(); ++b) {
+            if (reference_rings_touch(hole, polygon.holes[b])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * copia do caso com type e is_simple calculados apenas pela referencia
+ *
+ * o contorno e classificado por baseline::classify_polygons; um poligono com furos
+ * simples continua simples (e nunca convexo) se os furos forem validos. todas as
+ * funcoes de referencia abaixo leem a classificacao desta copia, nunca a do motor.
+ */
+static FuzzCase reference_case(const FuzzCase& fuzz_case) {
+    FuzzCase reference = fuzz_case;
+    baseline::classify_polygons(reference.polygons);
+
+    for (Polygon& polygon : reference.polygons) {
+        if (!polygon.is_simple || polygon.holes.empty()) {
+            continue;
+        }
+        polygon.is_simple = reference_holes_valid(polygon);
+        polygon.type = polygon.is_simple ? PolygonType::SIMPLE_NON_CONVEX : PolygonType::NOT_SIMPLE;
+    }
+    return reference;
+}
+
+// ids dos poligonos simples que contem cada ponto, via reference_inside
+static std::vector<std::vector<int>> reference_containers(const FuzzCase& fuzz_case) {
+    std::vector<std::vector<int>> result(fuzz_case.points.size());
+
+    for (size_t i = 0; i < fuzz_case.points.size(); ++i) {
+        for (const Polygon& polygon : fuzz_case.polygons) {
+            if (reference_inside(fuzz_case.points[i], polygon)) {
+                result[i].push_back(polygon.id);
+            }
+        }
+    }
+
+    return result;
+}
+
+// algum vertice (contorno e furos, ou so furos) de inner pertence a regiao de outer
+static bool any_vertex_inside(const Polygon& inner, const Polygon& outer, bool holes_only) {
+    for (const std::vector<Point>* ring : polygon_rings(inner)) {
+        if (holes_only && ring == &inner.vertices) {
+            continue;
+        }
+        for (const Point& p : *ring) {
+            if (reference_inside(p, outer)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// todos os vertices (contorno e furos) de inner pertencem a regiao de outer
+static bool all_vertices_inside(const Polygon& inner, const Polygon& outer) {
+    for (const std::vector<Point>* ring : polygon_rings(inner)) {
+        for (const Point& p : *ring) {
+            if (!reference_inside(p, outer)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// poligono com todas as arestas (contorno e furos) horizontais ou verticais
+static bool is_rectilinear(const Polygon& polygon) {
+    for (const std::vector<Point>* ring : polygon_rings(polygon)) {
+        if (!is_rectilinear_ring(*ring)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// contorno sem area (formula do laco, em 128 bits)
+static bool zero_area(const std::vector<Point>& ring) {
+    __int128 area2 = 0;
+    const int n = ring.size();
+    for (int i = 0; i < n; ++i) {
+        const Point& a = ring[i];
+        const Point& b = ring[(i + 1) % n];
+        area2 += static_cast<__int128>(a.x) * b.y - static_cast<__int128>(b.x) * a.y;
+    }
+    return area2 == 0;
+}
+
+// copia do poligono com as coordenadas dobradas
+static Polygon doubled(const Polygon& polygon) {
+    Polygon result = polygon;
+    for (Point& p : result.vertices) {
+        p = {2 * p.x, 2 * p.y};
+    }
+    for (auto& hole : result.holes) {
+        for (Point& p : hole) {
+            p = {2 * p.x, 2 * p.y};
+        }
+    }
+    return result;
+}
+
+struct CellRelation {
+    bool a_within_b;
+    bool b_within_a;
+    bool overlap;
+};
+
+/**
+ * compara as regioes de dois poligonos retilineos celula a celula
+ *
+ * as retas x = c e y = c pelos vertices dos dois poligonos dividem o plano em celulas
+ * que ficam inteiramente dentro ou fora de cada regiao; o centro de cada celula e testado
+ * com reference_inside nos poligonos dobrados (onde o centro tem coordenadas inteiras).
+ * exato mesmo quando as bordas se tocam, ao contrario do teste por vertices.
+ */
+static CellRelation reference_cells(const Polygon& a, const Polygon& b) {
+    std::vector<long long> xs, ys;
+    for (const Polygon* polygon : {&a, &b}) {
+        for (const std::vector<Point>* ring : polygon_rings(*polygon)) {
+            for (const Point& p : *ring) {
+                xs.push_back(p.x);
+                ys.push_back(p.y);
+            }
+        }
+    }
+    std::sort(xs.begin(), xs.end());
+    xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+    const Polygon a2 = doubled(a);
+    const Polygon b2 = doubled(b);
+    CellRelation relation = {true, true, false};
+
+    for (size_t i = 0; i + 1 < xs.size(); ++i) {
+        for (size_t j = 0; j + 1 < ys.size(); ++j) {
+            Point center = {xs[i] + xs[i + 1], ys[j] + ys[j + 1]};
+            bool in_a = reference_inside(center, a2);
+            bool in_b = reference_inside(center, b2);
+
+            if (in_a && !in_b) relation.a_within_b = false;
+            if (in_b && !in_a) relation.b_within_a = false;
+            if (in_a && in_b) relation.overlap = true;
+        }
+    }
+
+    return relation;
+}
+
+// cruzamento proprio entre dois segmentos: extremos de cada um estritamente em lados opostos
+static bool reference_cross(const Point& p1, const Point& q1, const Point& p2, const Point& q2) {
+    Orientation o1 = baseline::orientation(p1, q1, p2);
+    Orientation o2 = baseline::orientation(p1, q1, q2);
+    Orientation o3 = baseline::orientation(p2, q2, p1);
+    Orientation o4 = baseline::orientation(p2, q2, q1);
+    return o1 != Orientation::COLINEAR && o2 != Orientation::COLINEAR &&
+           o3 != Orientation::COLINEAR && o4 != Orientation::COLINEAR &&
+           o1 != o2 && o3 != o4;
+}
+
+/**
+ * relacao entre dois poligonos por forca bruta
+ *
+ * todas as arestas (contorno e furos) sao comparadas com baseline::do_intersect. sem contato,
+ * todos os vertices de cada poligono sao testados na regiao do outro: b esta contido
+ * em a se todos os seus vertices estao em a e nenhum furo de a esta em b. com contato,
+ * um cruzamento proprio e intersecao; bordas que apenas se tocam sao decididas celula
+ * a celula em poligonos simples retilineos de area positiva, e nos demais pares simples
+ * a referencia nao tem resposta (known = false).
+ */
+static PolygonRelation reference_relation(const Polygon& a, const Polygon& b, bool& known) {
+    known = true;
+    bool touch = false;
+
+    for (const std::vector<Point>* ring_a : polygon_rings(a)) {
+        for (const std::vector<Point>* ring_b : polygon_rings(b)) {
+            const int na = ring_a->size();
+            const int nb = ring_b->size();
+            for (int i = 0; i < na; ++i) {
+                for (int j = 0; j < nb; ++j) {
+                    const Point& p1 = (*ring_a)[i];
+                    const Point& q1 = (*ring_a)[(i + 1) % na];
+                    const Point& p2 = (*ring_b)[j];
+                    const Point& q2 = (*ring_b)[(j + 1) % nb];
+                    if (reference_cross(p1, q1, p2, q2)) {
+                        return PolygonRelation::INTERSECT;
+                    }
+                    touch = touch || baseline::do_intersect(p1, q1, p2, q2);
+                }
+            }
+        }
+    }
+
+    if (touch) {
+        // sem regiao confiavel, qualquer contato conta como intersecao
+        if (!a.is_simple || !b.is_simple) {
+            return PolygonRelation::INTERSECT;
+        }
+        if (!is_rectilinear(a) || !is_rectilinear(b) || zero_area(a.vertices) || zero_area(b.vertices)) {
+            known = false;
+            return PolygonRelation::INTERSECT;
+        }
+
+        CellRelation cells = reference_cells(a, b);
+        if (cells.b_within_a) return PolygonRelation::CONTAINS;
+        if (cells.a_within_b) return PolygonRelation::CONTAINED;
+        return cells.overlap ? PolygonRelation::INTERSECT : PolygonRelation::DISJOINT;
+    }
+
+    if (all_vertices_inside(b, a) && !any_vertex_inside(a, b, true)) {
+        return PolygonRelation::CONTAINS;
+    }
+    if (all_vertices_inside(a, b) && !any_vertex_inside(b, a, true)) {
+        return PolygonRelation::CONTAINED;
+    }
+
+    // regioes sobrepostas sem aninhamento (um cobre o furo do outro)
+    if (any_vertex_inside(b, a, false) || any_vertex_inside(a, b, false)) {
+        return PolygonRelation::INTERSECT;
+    }
+    return PolygonRelation::DISJOINT;
+}
+
+// relacao de referencia de cada par (i < j), com known[i][j] falso se nao ha referencia
+struct RelationReference {
+    std::vector<std::vector<PolygonRelation>> relation;
+    std::vector<std::vector<bool>> known;
+};
+
+static RelationReference reference_relations(const FuzzCase& fuzz_case) {
+    const std::vector<Polygon>& polygons = fuzz_case.polygons;
+    const size_t m = polygons.size();
+    RelationReference reference = {
+        std::vector<std::vector<PolygonRelation>>(m, std::vector<PolygonRelation>(m, PolygonRelation::DISJOINT)),
+        std::vector<std::vector<bool>>(m, std::vector<bool>(m, true))
+    };
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = i + 1; j < m; ++j) {
+            bool known = true;
+            reference.relation[i][j] = reference_relation(polygons[i], polygons[j], known);
+            reference.known[i][j] = known;
+        }
+    }
+
+    return reference;
+}
+
+// aresta mais proxima (contorno ou furo) entre os poligonos dados (todos os simples se ids for nulo)
+static NearestResult reference_border(const FuzzCase& fuzz_case, const Point& point,
+                                      const std::vector<int>* ids) {
+    NearestResult best = {0, 0.0};
+
+    for (const Polygon& polygon : fuzz_case.polygons) {
+        if (!polygon.is_simple ||
+            (ids && std::find(ids->begin(), ids->end(), polygon.id) == ids->end())) {
+            continue;
+        }
+
+        for (const std::vector<Point>* ring : polygon_rings(polygon)) {
+            const int n = ring->size();
+            for (int i = 0; i < n; ++i) {
+                double d2 = segment_distance2(point, (*ring)[i], (*ring)[(i + 1) % n]);
+                if (best.polygon_id == 0 || d2 < best.distance2) {
+                    best.polygon_id = polygon.id;
+                    best.distance2 = d2;
+                }
+            }
+        }
+    }
+
+    return best;
+}
+
+// aresta mais proxima entre todas as arestas dos poligonos simples
+static NearestResult reference_nearest(const FuzzCase& fuzz_case, const Point& point) {
+    return reference_border(fuzz_case, point, nullptr);
+}
+
+// referencia do sufixo de --distancia: para pontos contidos, a borda mais proxima entre os
+// poligonos que contem o ponto
+static NearestResult reference_distance(const FuzzCase& fuzz_case, const Point& point,
+                                        const std::vector<int>& containers) {
+    return reference_border(fuzz_case, point, containers.empty() ? nullptr : &containers);
+}
+
+// aninhamento entre os poligonos simples, por forca bruta: within[i][j] se a regiao do
+// poligono i esta contida na do j. laminar e falso se algum par se sobrepoe sem aninhar
+struct NestingReference {
+    std::vector<std::vector<bool>> within;
+    bool laminar;
+};
+
+static NestingReference reference_nesting(const FuzzCase& fuzz_case) {
+    const std::vector<Polygon>& polygons = fuzz_case.polygons;
+    const size_t m = polygons.size();
+    NestingReference nesting = {std::vector<std::vector<bool>>(m, std::vector<bool>(m, false)), true};
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = i + 1; j < m; ++j) {
+            if (!polygons[i].is_simple || !polygons[j].is_simple) {
+                continue;
+            }
+
+            // bordas que se tocam so tem referencia exata para poligonos retilineos
+            if (is_rectilinear(polygons[i]) && is_rectilinear(polygons[j])) {
+                CellRelation cells = reference_cells(polygons[i], polygons[j]);
+                nesting.within[i][j] = cells.a_within_b;
+                nesting.within[j][i] = cells.b_within_a;
+                if (cells.overlap && !cells.a_within_b && !cells.b_within_a) {
+                    nesting.laminar = false;
+                }
+                continue;
+            }
+
+            bool known = true;
+            PolygonRelation relation = reference_relation(polygons[i], polygons[j], known);
+            if (!known) {
+                nesting.laminar = false; // sem referencia, o caso nao e verificado
+                continue;
+            }
+
+            switch (relation) {
+                case PolygonRelation::CONTAINS:
+                    nesting.within[j][i] = true;
+                    break;
+                case PolygonRelation::CONTAINED:
+                    nesting.within[i][j] = true;
+                    break;
+                case PolygonRelation::INTERSECT:
+                    nesting.laminar = false;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    return nesting;
+}
+
+// o poligono mais interno e o que esta contido em todos os outros que contem o ponto.
+// -1 se a resposta e ambigua: poligonos repetidos, ou ponto na borda comum de dois
+// irmaos que se tocam (nenhum dos dois contem o outro)
+static int reference_innermost(const NestingReference& nesting, const std::vector<int>& containers) {
+    int innermost = 0;
+
+    for (int candidate : containers) {
+        bool inside_all = true;
+        for (int other : containers) {
+            if (other != candidate && !nesting.within[candidate - 1][other - 1]) {
+                inside_all = false;
+                break;
+            }
+        }
+        if (inside_all) {
+            if (innermost != 0) {
+                return -1;
+            }
+            innermost = candidate;
+        }
+    }
+
+    return (innermost == 0 && !containers.empty()) ? -1 : innermost;
+}
+
+// ---- comparacao com os motores acelerados ----
+
+static std::string describe_point(size_t index, const Point& point) {
+    std::ostringstream out;
+    out << "ponto " << (index + 1) << " (" << point.x << ", " << point.y << ")";
+    return out.str();
+}
+
+static std::string check_classification(const FuzzCase& fuzz_case) {
+    const FuzzCase reference = reference_case(fuzz_case);
+
+    for (size_t k = 0; k < fuzz_case.polygons.size(); ++k) {
+        const Polygon& expected = reference.polygons[k];
+        const Polygon& actual = fuzz_case.polygons[k];
+        if (expected.type != actual.type || expected.is_simple != actual.is_simple) {
+            return "poligono " + std::to_string(actual.id) + ": esperado " +
+                   polygon_type_to_string(expected.type) + ", obtido " +
+                   polygon_type_to_string(actual.type);
+        }
+    }
+    return "";
+}
+
+static std::string check_containment(const FuzzCase& fuzz_case, FillRule rule) {
+    const FuzzCase reference = reference_case(fuzz_case);
+
+    for (size_t i = 0; i < fuzz_case.points.size(); ++i) {
+        for (size_t k = 0; k < fuzz_case.polygons.size(); ++k) {
+            const Polygon& polygon = fuzz_case.polygons[k];
+
+            // na regra nao-zero, so poligonos simples tem resposta de referencia
+            if (rule == FillRule::NONZERO && !reference.polygons[k].is_simple) {
+                continue;
+            }
+
+            bool expected = reference_inside(fuzz_case.points[i], reference.polygons[k]);
+            bool actual = contains(fuzz_case.points[i], polygon, rule);
+            if (expected != actual) {
+                return describe_point(i, fuzz_case.points[i]) + ", poligono " +
+                       std::to_string(polygon.id) + ": esperado " + (expected ? "dentro" : "fora");
+            }
+        }
+    }
+    return "";
+}
+
+// relacao obtida pelo motor para o par (i, j), DISJOINT se o par nao esta na lista
+static PolygonRelation find_pair(const std::vector<PolygonPair>& pairs, int first_id, int second_id) {
+    for (const PolygonPair& pair : pairs) {
+        if (pair.first_id == first_id && pair.second_id == second_id) {
+            return pair.relation;
+        }
+    }
+    return PolygonRelation::DISJOINT;
+}
+
+static std::string check_relations(const FuzzCase& fuzz_case) {
+    RelationReference expected = reference_relations(reference_case(fuzz_case));
+    std::vector<PolygonPair> actual = find_polygon_relations(fuzz_case.polygons, FillRule::EVEN_ODD);
+    const std::vector<Polygon>& polygons = fuzz_case.polygons;
+
+    for (size_t i = 0; i < polygons.size(); ++i) {
+        for (size_t j = i + 1; j < polygons.size(); ++j) {
+            if (!expected.known[i][j]) {
+                continue;
+            }
+
+            PolygonRelation relation = find_pair(actual, polygons[i].id, polygons[j].id);
+            if (relation != expected.relation[i][j]) {
+                return "par " + std::to_string(polygons[i].id) + " " +
+                       std::to_string(polygons[j].id) + ": esperado " +
+                       polygon_relation_to_string(expected.relation[i][j]) + ", obtido " +
+                       polygon_relation_to_string(relation);
+            }
+        }
+    }
+    return "";
+}
+
+static std::string check_nearest(const FuzzCase& fuzz_case) {
+    const FuzzCase reference = reference_case(fuzz_case);
+    Arena arena;
+    SegmentIndex index = build_segment_index(fuzz_case.polygons, FillRule::EVEN_ODD, &arena);
+
+    for (size_t i = 0; i < fuzz_case.points.size(); ++i) {
+        NearestResult expected = reference_nearest(reference, fuzz_case.points[i]);
+        NearestResult actual = find_nearest_polygon(index, fuzz_case.points[i]);
+
+        if (expected.polygon_id != actual.polygon_id || expected.distance2 != actual.distance2) {
+            std::ostringstream out;
+            out << describe_point(i, fuzz_case.points[i]) << ": esperado " << expected.polygon_id
+                << " " << expected.distance2 << ", obtido " << actual.polygon_id << " "
+                << actual.distance2;
+            return out.str();
+        }
+    }
+
+    // pontos contidos: borda mais proxima entre os poligonos que os contem
+    std::vector<std::vector<int>> containers = reference_containers(reference);
+    for (size_t i = 0; i < fuzz_case.points.size(); ++i) {
+        if (containers[i].empty()) {
+            continue;
+        }
+
+        std::vector<int> ids;
+        for (const Polygon& polygon : fuzz_case.polygons) {
+            if (contains(fuzz_case.points[i], polygon, FillRule::EVEN_ODD)) {
+                ids.push_back(polygon.id);
+            }
+        }
+
+        NearestResult expected = reference_distance(reference, fuzz_case.points[i], containers[i]);
+        NearestResult actual = find_reference_border(index, fuzz_case.points[i], ids.data(),
+                                                     ids.size());
+
+        if (expected.polygon_id != actual.polygon_id || expected.distance2 != actual.distance2) {
+            std::ostringstream out;
+            out << describe_point(i, fuzz_case.points[i]) << " (contido): esperado "
+                << expected.polygon_id << " " << expected.distance2 << ", obtido "
+                << actual.polygon_id << " " << actual.distance2;
+            return out.str();
+        }
+    }
+    return "";
+}
+
+static std::string check_hierarchy(const FuzzCase& fuzz_case) {
+    // fora de familias laminares a hierarquia nao define um unico poligono mais interno
+    const FuzzCase reference = reference_case(fuzz_case);
+    NestingReference nesting = reference_nesting(reference);
+    if (!nesting.laminar) {
+        return "";
+    }
+
+    Arena arena;
+    ContainmentHierarchy hierarchy = build_hierarchy(fuzz_case.polygons, FillRule::EVEN_ODD, &arena);
+    std::vector<std::vector<int>> containers = reference_containers(reference);
+
+    for (size_t i = 0; i < fuzz_case.points.size(); ++i) {
+        int expected = reference_innermost(nesting, containers[i]);
+        if (expected < 0) {
+            continue;
+        }
+
+        int actual = find_innermost_polygon(hierarchy, fuzz_case.polygons, fuzz_case.points[i]);
+        if (expected != actual) {
+            return describe_point(i, fuzz_case.points[i]) + ": esperado " +
+                   std::to_string(expected) + ", obtido " + std::to_string(actual);
+        }
+    }
+    return "";
+}
+
+std::string check_kind(const FuzzCase& fuzz_case, MismatchKind kind) {
+    switch (kind) {
+        case MismatchKind::CLASSIFICATION:
+            return check_classification(fuzz_case);
+        case MismatchKind::CONTAINMENT:
+            return check_containment(fuzz_case, FillRule::EVEN_ODD);
+        case MismatchKind::WINDING:
+            return check_containment(fuzz_case, FillRule::NONZERO);
+        case MismatchKind::RELATIONS:
+            return check_relations(fuzz_case);
+        case MismatchKind::NEAREST:
+            return check_nearest(fuzz_case);
+        case MismatchKind::HIERARCHY:
+            return check_hierarchy(fuzz_case);
+        default:
+            return "";
+    }
+}
+
+Mismatch check_case(const FuzzCase& fuzz_case) {
+    static const MismatchKind kinds[] = {
+        MismatchKind::CLASSIFICATION, MismatchKind::CONTAINMENT, MismatchKind::WINDING,
+        MismatchKind::RELATIONS, MismatchKind::NEAREST, MismatchKind::HIERARCHY
+    };
+
+    for (MismatchKind kind : kinds) {
+        std::string detail = check_kind(fuzz_case, kind);
+        if (!detail.empty()) {
+            return {kind, detail};
+        }
+    }
+    return {MismatchKind::NONE, ""};
+}
+
+std::string expected_output(const FuzzCase& fuzz_case, MismatchKind kind) {
+    std::ostringstream out;
+    const FuzzCase reference = reference_case(fuzz_case);
+
+    for (const Polygon& polygon : reference.polygons) {
+        out << polygon.id << " " << polygon_type_to_string(polygon.type) << "\n";
+    }
+
+    std::vector<std::vector<int>> containers = reference_containers(reference);
+    NestingReference nesting = reference_nesting(reference);
+
+    // pontos com mais interno ambiguo nao sao verificados; a saida repete a do motor
+    Arena arena;
+    ContainmentHierarchy hierarchy;
+    if (kind == MismatchKind::HIERARCHY) {
+        hierarchy = build_hierarchy(fuzz_case.polygons, FillRule::EVEN_ODD, &arena);
+    }
+
+    for (size_t i = 0; i < fuzz_case.points.size(); ++i) {
+        out << (i + 1) << ":";
+
+        if (kind == MismatchKind::HIERARCHY) {
+            int innermost = reference_innermost(nesting, containers[i]);
+            if (innermost < 0) {
+                innermost = find_innermost_polygon(hierarchy, fuzz_case.polygons, fuzz_case.points[i]);
+            }
+            if (innermost != 0) {
+                out << " " << innermost;
+            }
+        } else {
+            for (int polygon_id : containers[i]) {
+                out << " " << polygon_id;
+            }
+        }
+
+        if (kind == MismatchKind::NEAREST) {
+            NearestResult nearest = reference_distance(reference, fuzz_case.points[i], containers[i]);
+            if (nearest.polygon_id != 0) {
+                out << " | " << nearest.polygon_id << " " << std::setprecision(15) << nearest.distance2;
+            }
+        }
+
+        out << "\n";
+    }
+
+    // pares sem referencia repetem a relacao do motor
+    if (kind == MismatchKind::RELATIONS) {
+        RelationReference relations = reference_relations(reference);
+        std::vector<PolygonPair> actual = find_polygon_relations(fuzz_case.polygons, FillRule::EVEN_ODD);
+        const std::vector<Polygon>& polygons = fuzz_case.polygons;
+
+        for (size_t i = 0; i < polygons.size(); ++i) {
+            for (size_t j = i + 1; j < polygons.size(); ++j) {
+                PolygonRelation relation = relations.known[i][j] ? relations.relation[i][j] :
+                    find_pair(actual, polygons[i].id, polygons[j].id);
+                if (relation != PolygonRelation::DISJOINT) {
+                    out << polygons[i].id << " " << polygons[j].id << " "
+                        << polygon_relation_to_string(relation) << "\n";
+                }
+            }
+        }
+    }
+
+    return out.str();
+}
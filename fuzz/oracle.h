@@ -0,0 +1,38 @@
+#ifndef FUZZ_ORACLE_H
+#define FUZZ_ORACLE_H
+
+#include <string>
+#include "generators.h"
+
+// qual motor acelerado divergiu da implementacao de referencia
+enum class MismatchKind {
+    NONE,
+    CLASSIFICATION, // classify_polygons x is_simple/is_convex da copia congelada (baseline.cpp)
+    CONTAINMENT,    // contains (par-impar) x is_inside no contorno e nos furos
+    WINDING,        // contains (nao-zero) x is_inside, em poligonos simples
+    RELATIONS,      // find_polygon_relations x todas as arestas e todos os vertices dos pares
+    NEAREST,        // R-tree de arestas x varredura de todas as arestas
+    HIERARCHY       // hierarquia de contencao x aninhamento por forca bruta (familias laminares)
+};
+
+struct Mismatch {
+    MismatchKind kind;
+    std::string detail;
+};
+
+std::string mismatch_kind_to_string(MismatchKind kind);
+
+// roda todos os motores contra a referencia e devolve a primeira divergencia (NONE se nenhuma)
+Mismatch check_case(const FuzzCase& fuzz_case);
+
+// descricao da divergencia de um motor especifico (vazio se concordam)
+std::string check_kind(const FuzzCase& fuzz_case, MismatchKind kind);
+
+// opcoes de linha de comando que ativam o motor no executavel poligonos
+// (com --furos quando o caso tem furos)
+std::string mismatch_args(const FuzzCase& fuzz_case, MismatchKind kind);
+
+// saida esperada do executavel, calculada apenas com as funcoes de referencia (baseline.h)
+std::string expected_output(const FuzzCase& fuzz_case, MismatchKind kind);
+
+#endif // FUZZ_ORACLE_H
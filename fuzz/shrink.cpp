@@ -0,0 +1,103 @@
+#include "shrink.h"
+
+using namespace polygonpoint;
+
+// aceita o candidato se ele ainda diverge no mesmo motor
+static bool try_candidate(FuzzCase& current, FuzzCase candidate, MismatchKind kind) {
+    finalize_case(candidate);
+    if (check_kind(candidate, kind).empty()) {
+        return false;
+    }
+    current = candidate;
+    return true;
+}
+
+// aproxima a coordenada de zero (metade do caminho, ou zero direto)
+static bool shrink_coordinate(long long& value, bool halve) {
+    if (value == 0) {
+        return false;
+    }
+    value = halve ? value / 2 : 0;
+    return true;
+}
+
+// anel r do poligono i: 0 e o contorno, r > 0 e o furo r - 1
+static std::vector<Point>& ring_at(FuzzCase& fuzz_case, size_t i, size_t r) {
+    Polygon& polygon = fuzz_case.polygons[i];
+    return (r == 0) ? polygon.vertices : polygon.holes[r - 1];
+}
+
+static bool shrink_step(FuzzCase& current, MismatchKind kind) {
+    // 1. remover poligonos inteiros
+    for (size_t i = 0; i < current.polygons.size(); ++i) {
+        FuzzCase candidate = current;
+        candidate.polygons.erase(candidate.polygons.begin() + i);
+        if (try_candidate(current, candidate, kind)) return true;
+    }
+
+    // 2. remover pontos
+    for (size_t i = 0; i < current.points.size(); ++i) {
+        FuzzCase candidate = current;
+        candidate.points.erase(candidate.points.begin() + i);
+        if (try_candidate(current, candidate, kind)) return true;
+    }
+
+    // 3. remover furos inteiros
+    for (size_t i = 0; i < current.polygons.size(); ++i) {
+        for (size_t h = 0; h < current.polygons[i].holes.size(); ++h) {
+            FuzzCase candidate = current;
+            candidate.polygons[i].holes.erase(candidate.polygons[i].holes.begin() + h);
+            if (try_candidate(current, candidate, kind)) return true;
+        }
+    }
+
+    // 4. remover vertices de qualquer anel (mantendo ao menos um por anel)
+    for (size_t i = 0; i < current.polygons.size(); ++i) {
+        for (size_t r = 0; r <= current.polygons[i].holes.size(); ++r) {
+            for (size_t j = 0; ring_at(current, i, r).size() > 1 &&
+                               j < ring_at(current, i, r).size(); ++j) {
+                FuzzCase candidate = current;
+                std::vector<Point>& ring = ring_at(candidate, i, r);
+                ring.erase(ring.begin() + j);
+                if (try_candidate(current, candidate, kind)) return true;
+            }
+        }
+    }
+
+    // 5. aproximar coordenadas de zero
+    for (int halve = 0; halve <= 1; ++halve) {
+        for (size_t i = 0; i < current.polygons.size(); ++i) {
+            for (size_t r = 0; r <= current.polygons[i].holes.size(); ++r) {
+                for (size_t j = 0; j < ring_at(current, i, r).size(); ++j) {
+                    FuzzCase candidate = current;
+                    if (shrink_coordinate(ring_at(candidate, i, r)[j].x, halve) &&
+                        try_candidate(current, candidate, kind)) return true;
+
+                    candidate = current;
+                    if (shrink_coordinate(ring_at(candidate, i, r)[j].y, halve) &&
+                        try_candidate(current, candidate, kind)) return true;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < current.points.size(); ++i) {
+            FuzzCase candidate = current;
+            if (shrink_coordinate(candidate.points[i].x, halve) &&
+                try_candidate(current, candidate, kind)) return true;
+
+            candidate = current;
+            if (shrink_coordinate(candidate.points[i].y, halve) &&
+                try_candidate(current, candidate, kind)) return true;
+        }
+    }
+
+    return false;
+}
+
+FuzzCase shrink_case(const FuzzCase& fuzz_case, MismatchKind kind) {
+    FuzzCase current = fuzz_case;
+    while (shrink_step(current, kind)) {
+        // cada passo aceito deixa o caso estritamente menor; repetir ate estabilizar
+    }
+    return current;
+}
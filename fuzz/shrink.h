@@ -0,0 +1,10 @@
+#ifndef FUZZ_SHRINK_H
+#define FUZZ_SHRINK_H
+
+#include "oracle.h"
+
+// reduz um caso que diverge no motor kind ate um minimo local que ainda diverge:
+// remove poligonos, pontos, furos e vertices e aproxima coordenadas de zero, um passo por vez
+FuzzCase shrink_case(const FuzzCase& fuzz_case, MismatchKind kind);
+
+#endif // FUZZ_SHRINK_H
@@ -0,0 +1,54 @@
+// executa o alvo do libFuzzer (fuzz_target.cpp) sem o libFuzzer, para ambientes sem clang:
+// sem arquivos, alimenta o alvo com bytes aleatorios; com arquivos, roda cada um uma vez
+// (por exemplo, entradas gravadas pelo libFuzzer). compilado com g++ e ASan/UBSan.
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+int main(int argc, char* argv[]) {
+    long long iterations = 100000;
+    unsigned seed = 1;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--iteracoes" && i + 1 < argc) {
+            iterations = std::stoll(argv[++i]);
+        } else if (arg == "--semente" && i + 1 < argc) {
+            seed = std::stoul(argv[++i]);
+        } else {
+            files.push_back(arg);
+        }
+    }
+
+    for (const std::string& path : files) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "Erro: nao foi possivel abrir " << path << std::endl;
+            return 1;
+        }
+        std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        LLVMFuzzerTestOneInput(data.data(), data.size());
+    }
+
+    if (files.empty()) {
+        std::mt19937 rng(seed);
+        std::vector<uint8_t> data;
+        for (long long i = 0; i < iterations; ++i) {
+            data.resize(rng() % 128);
+            for (uint8_t& byte : data) {
+                byte = static_cast<uint8_t>(rng());
+            }
+            LLVMFuzzerTestOneInput(data.data(), data.size());
+        }
+        std::cout << iterations << " entradas sem divergencia (semente " << seed << ")" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,719 @@
+#include <algorithm>
+#include <istream>
+#include "geometry.h"
+
+namespace polygonpoint {
+
+/**
+ * calcula a orientacao entre 3 pontos (p, q, r)
+ *
+ * @param p, q, r  pontos
+ * @return COLINEAR || ANTIHORARIO || HORARIO
+ */
+Orientation orientation(Point p, Point q, Point r) {
+    // cross product 2D
+    long long val = (q.y - p.y) * (r.x - q.x) - (q.x - p.x) * (r.y - q.y);
+
+    if (val == 0) return Orientation::COLINEAR; // colinear
+
+    return (val > 0) ? Orientation::ANTIHORARIO : Orientation::HORARIO;
+}
+
+// verifica se o ponto q esta no segmento pr (assumindo colinearidade)
+bool on_segment(Point p, Point q, Point r) {
+    return (q.x <= std::max(p.x, r.x) && q.x >= std::min(p.x, r.x) &&
+            q.y <= std::max(p.y, r.y) && q.y >= std::min(p.y, r.y));
+}
+
+/**
+ * verifica se dois segmentos de reta se intersectam.
+ *
+ * @param p1 primeiro ponto do primeiro segmento
+ * @param q1 segundo ponto do primeiro segmento
+ * @param p2 primeiro ponto do segundo segmento
+ * @param q2 segundo ponto do segundo segmento
+ * @return boolean << se os segmentos se intersectam
+ */
+bool do_intersect(const Point& p1, const Point& q1, const Point& p2, const Point& q2) {
+    // verificar as 4 orientacoes necessarias
+    Orientation o1 = orientation(p1, q1, p2);
+    Orientation o2 = orientation(p1, q1, q2);
+    Orientation o3 = orientation(p2, q2, p1);
+    Orientation o4 = orientation(p2, q2, q1);
+    
+    // caso geral: se para cada segmento os dois pontos do outro segmento estao em sentidos opostos os segmentos se cruzam
+    if (o1 != o2 && o3 != o4) {
+        return true;
+    }
+    
+    // casos especiais: se um ponto tem orientacao colinear com o segmento, checamos se esta dentro dos "limites" do segmento 
+    if (o1 == Orientation::COLINEAR && on_segment(p1, p2, q1)) return true;
+    if (o2 == Orientation::COLINEAR && on_segment(p1, q2, q1)) return true;
+    if (o3 == Orientation::COLINEAR && on_segment(p2, p1, q2)) return true;
+    if (o4 == Orientation::COLINEAR && on_segment(p2, q1, q2)) return true;
+    
+    return false;
+}
+
+
+/**
+ * verifica se um poligono e simples (sem auto-intersecoes)
+ * um poligono e considerado simples se:
+ * 1. tem pelo menos 3 vertices
+ * 2. nao possui arestas nao-adjacentes que se interceptam
+ */
+bool is_simple(const Polygon& poly) {
+    return is_simple_ring(poly.vertices);
+}
+
+// mesma verificacao de is_simple, aplicada a um anel qualquer (contorno externo ou furo)
+bool is_simple_ring(const std::vector<Point>& ring) {
+    int n = ring.size();
+    
+    if (n < 3) {
+        return false; // poligonos com menos de 3 vertices nao sao simples por definicao
+    }
+
+    // verifica se ha intersecoes entre arestas nao-adjacentes
+    for (int i = 0; i < n; ++i) {
+        Point p1 = ring[i];
+        Point q1 = ring[(i + 1) % n]; // proximo vertice (% usa vetor como anel)
+
+        // verificar contra todas as outras arestas nao-adjacentes
+        for (int j = i + 2; j < n; ++j) {
+
+            if ((j + 1) % n == i) {
+                continue; // arestas adjacentes (ultima e primeira)
+            }
+
+            Point p2 = ring[j];
+            Point q2 = ring[(j + 1) % n];
+
+            // verificar interseccao
+            if (do_intersect(p1, q1, p2, q2)) {
+                return false; // encontrada interseccao entre arestas nao-adjacentes
+            }
+        }
+    }
+
+    return true; // nenhuma interseccao encontrada
+}
+
+/**
+ * verifica se um poligono simples e convexo
+ * um poligono e convexo se todos os angulos internos sao menores ou iguais a 180 graus.
+ * matematicamente, isso significa que todas as "viradas" devem ser na mesma direcao.
+ */
+bool is_convex(const Polygon& poly) {
+    int n = poly.vertices.size();
+    
+    // verificacoes preliminares
+    if (n < 3) {
+        return false; // nao e um poligono valido
+    }
+    
+    // para um poligono ser convexo, todas as orientacoes entre 3 pontos sequenciais devem ser a mesma
+    // primeiro, encontra a primeira orientacao nao-colinear para usar como referencia
+    Orientation reference_orientation = Orientation::COLINEAR;
+    bool has_orientation = false;
+    
+    // encontrar a primeira orientacao nao-colinear
+    for (int i = 0; i < n && !has_orientation; ++i) {
+        Point p1 = poly.vertices[i];
+        Point p2 = poly.vertices[(i + 1) % n];
+        Point p3 = poly.vertices[(i + 2) % n];
+        
+        Orientation orient = orientation(p1, p2, p3);
+        if (orient != Orientation::COLINEAR) {
+            reference_orientation = orient;
+            has_orientation = true;
+        }
+    }
+    
+    // se todos os pontos sao colineares, consideramos convexo (e um segmento de reta)
+    if (!has_orientation) {
+        return true;
+    }
+    
+    // agora verificamos se todas as orientacoes sao iguais a referencia ou colineares
+    for (int i = 0; i < n; ++i) {
+        Point p1 = poly.vertices[i];
+        Point p2 = poly.vertices[(i + 1) % n];
+        Point p3 = poly.vertices[(i + 2) % n];
+        
+        Orientation orient = orientation(p1, p2, p3);
+        
+        // se encontrarmos uma orientacao diferente da referencia e nao-colinear, nao e convexo
+        if (orient != Orientation::COLINEAR && orient != reference_orientation) {
+            return false;
+        }
+    }
+    
+    return true; // todas as orientacoes sao consistentes, o poligono e convexo
+}
+
+
+/**
+ * verifica se um ponto esta dentro de um poligono simples
+ * 
+ * implementa o algoritmo de ray casting (parity method):
+ * - traca um raio horizontal a partir do ponto
+ * - conta as intersecoes com as arestas do poligono
+ * - numero impar de intersecoes: ponto esta dentro
+ * - numero par de intersecoes: ponto esta fora
+ * - pontos sobre arestas ou vertices sao considerados dentro
+ *
+ * @param point o ponto a ser verificado
+ * @param polygon o poligono a ser testado
+ * @return true se o ponto estiver dentro ou sobre o poligono, false caso contrario
+ */
+bool is_inside(const Point& point, const Polygon& polygon) {
+    // poligonos nao-simples ou com menos de 3 vertices nao contem pontos
+    if (!polygon.is_simple || polygon.vertices.size() < 3) {
+        return false;
+    }
+
+    return is_inside_ring(point, polygon.vertices);
+}
+
+// ray casting de is_inside sobre um anel qualquer, sem a checagem de simplicidade
+bool is_inside_ring(const Point& point, const std::vector<Point>& ring) {
+    const int n = ring.size();
+
+    // comecamos com false e vamos invertendo a variavel a cada interseccao encontrada (%2)
+    bool inside = false;
+    
+    // primeiro, verificar se o ponto esta sobre alguma aresta ou vertice
+    for (int i = 0; i < n; i++) {
+        const Point& current = ring[i];
+        const Point& next = ring[(i + 1) % n];
+        
+        // verificar se o ponto esta sobre um vertice
+        if (point.x == current.x && point.y == current.y) {
+            return true;
+        }
+        
+        // verificar se o ponto esta sobre uma aresta
+        if (orientation(current, point, next) == Orientation::COLINEAR && 
+            on_segment(current, point, next)) {
+            return true;
+        }
+    }
+    
+    // implementacao do algoritmo ray casting
+    for (int i = 0, j = n - 1; i < n; j = i++) {
+        const Point& vi = ring[i];
+        const Point& vj = ring[j];
+        
+        // condicao para verificar se a aresta cruza o raio horizontal
+        bool cross_x_ray = (vi.y > point.y) != (vj.y > point.y);
+        
+        // se a aresta nao cruza horizontalmente, pule para a proxima aresta
+        if (!cross_x_ray) continue;
+
+        // a partir daqui, sabemos que o ponto esta no range vertical do segmento
+        
+        // verificar se a interseccao esta a direita do ponto
+        // caso especial: aresta vertical
+        if (vi.x == vj.x) {
+            if (vi.x > point.x) {
+                inside = !inside;
+            }
+            continue;
+        }
+        
+        // caso geral: calcular a interseccao
+        // evitar divisao por zero (embora ja deveria estar garantido por cross_x_ray)
+        if (vj.y - vi.y == 0) continue;
+        
+        // calcular o ponto x onde a aresta cruza o raio horizontal
+        double x_intersect = static_cast<double>(vj.x - vi.x) * (point.y - vi.y) / (vj.y - vi.y) + vi.x;
+        
+        // se a interseccao esta a direita do ponto, inverte o estado
+        if (x_intersect > point.x) {
+            inside = !inside;
+        }
+    }
+    
+    return inside;
+}
+
+
+// verifica se o ponto esta sobre algum vertice ou aresta do anel
+bool on_ring_border(const Point& point, const std::vector<Point>& ring) {
+    const int n = ring.size();
+
+    for (int i = 0; i < n; i++) {
+        const Point& current = ring[i];
+        const Point& next = ring[(i + 1) % n];
+
+        if (orientation(current, point, next) == Orientation::COLINEAR &&
+            on_segment(current, point, next)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * calcula o numero de voltas (winding number) de um anel em torno de um ponto
+ *
+ * percorre as arestas contando quantas cruzam o raio horizontal a direita do ponto:
+ * - aresta subindo com o ponto a sua esquerda: +1
+ * - aresta descendo com o ponto a sua direita: -1
+ * todas as contas sao inteiras (produto vetorial em long long), sem ponto flutuante.
+ * o resultado nao e definido para pontos sobre a borda (use on_ring_border antes).
+ *
+ * @param point o ponto de referencia
+ * @param ring vertices do anel, em qualquer sentido
+ * @return numero de voltas (0 se o ponto esta fora)
+ */
+int winding_number(const Point& point, const std::vector<Point>& ring) {
+    const int n = ring.size();
+    int winding = 0;
+
+    for (int i = 0; i < n; i++) {
+        const Point& a = ring[i];
+        const Point& b = ring[(i + 1) % n];
+
+        // > 0: ponto a esquerda de a->b, < 0: a direita, 0: colinear
+        long long side = (b.x - a.x) * (point.y - a.y) - (point.x - a.x) * (b.y - a.y);
+
+        if (a.y <= point.y) {
+            if (b.y > point.y && side > 0) {
+                ++winding; // aresta subindo, cruza o raio a direita do ponto
+            }
+        } else {
+            if (b.y <= point.y && side < 0) {
+                --winding; // aresta descendo, cruza o raio a direita do ponto
+            }
+        }
+    }
+
+    return winding;
+}
+
+// ponto dentro ou sobre o anel pela regra nao-zero (numero de voltas diferente de zero)
+bool is_inside_winding(const Point& point, const std::vector<Point>& ring) {
+    if (ring.size() < 3) {
+        return false;
+    }
+
+    return on_ring_border(point, ring) || winding_number(point, ring) != 0;
+}
+
+// testa o anel com a regra de preenchimento escolhida (bordas sempre contam como dentro)
+bool ring_contains(const Point& point, const std::vector<Point>& ring, FillRule rule) {
+    if (rule == FillRule::NONZERO) {
+        return is_inside_winding(point, ring);
+    }
+    return is_inside_ring(point, ring);
+}
+
+bool can_contain_points(const Polygon& polygon, FillRule rule) {
+    if (polygon.vertices.size() < 3) {
+        return false;
+    }
+
+    // na regra par-impar apenas poligonos simples contem pontos (comportamento original);
+    // na regra nao-zero a regiao de um poligono nao simples tambem e bem definida
+    return rule == FillRule::NONZERO || polygon.is_simple;
+}
+
+/**
+ * verifica se um ponto pertence a regiao de um poligono com furos
+ *
+ * o ponto precisa estar dentro (ou sobre a borda) do contorno externo e nao pode
+ * estar estritamente dentro de nenhum furo; a borda de um furo pertence ao poligono.
+ * sem furos e com a regra par-impar o resultado e identico ao de is_inside.
+ *
+ * @param point o ponto a ser verificado
+ * @param polygon o poligono (contorno externo + furos)
+ * @param rule regra de preenchimento aplicada a cada anel
+ * @return true se o ponto pertence a regiao do poligono
+ */
+bool contains(const Point& point, const Polygon& polygon, FillRule rule) {
+    if (!can_contain_points(polygon, rule)) {
+        return false;
+    }
+
+    if (!ring_contains(point, polygon.vertices, rule)) {
+        return false;
+    }
+
+    for (const auto& hole : polygon.holes) {
+        if (!on_ring_border(point, hole) && ring_contains(point, hole, rule)) {
+            return false; // estritamente dentro de um furo
+        }
+    }
+
+    return true;
+}
+
+/**
+ * verifica se os furos de um poligono sao validos:
+ * cada furo e um anel simples, nenhuma aresta de um furo cruza o contorno externo
+ * ou outro furo, e todo furo fica dentro do contorno externo
+ */
+bool holes_are_valid(const Polygon& poly) {
+    const int h = poly.holes.size();
+
+    for (int a = 0; a < h; ++a) {
+        const std::vector<Point>& hole = poly.holes[a];
+
+        if (!is_simple_ring(hole)) {
+            return false;
+        }
+
+        // o primeiro vertice basta, pois as arestas nao cruzam o contorno (verificado abaixo)
+        if (!is_inside_ring(hole[0], poly.vertices)) {
+            return false;
+        }
+
+        if (rings_intersect(hole, poly.vertices)) {
+            return false;
+        }
+
+        for (int b = a + 1; b < h; ++b) {
+            if (rings_intersect(hole, poly.holes[b])) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// verifica se alguma aresta do anel a intersecta alguma aresta do anel b
+bool rings_intersect(const std::vector<Point>& a, const std::vector<Point>& b) {
+    const int na = a.size();
+    const int nb = b.size();
+
+    for (int i = 0; i < na; ++i) {
+        for (int j = 0; j < nb; ++j) {
+            if (do_intersect(a[i], a[(i + 1) % na], b[j], b[(j + 1) % nb])) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// duas vezes a area (sem sinal) delimitada pelo anel, pela formula do laco (shoelace)
+long long ring_area2(const std::vector<Point>& ring) {
+    const int n = ring.size();
+    long long area2 = 0;
+
+    for (int i = 0; i < n; ++i) {
+        const Point& a = ring[i];
+        const Point& b = ring[(i + 1) % n];
+        area2 += a.x * b.y - b.x * a.y;
+    }
+
+    return area2 < 0 ? -area2 : area2;
+}
+
+/**
+ * encontra um ponto estritamente interior a regiao de um anel simples com furos
+ *
+ * v e o vertice mais baixo (e mais a esquerda) do contorno, sempre convexo, e u, w sao
+ * seus vizinhos. se nenhum outro vertice (do contorno ou dos furos) esta no triangulo uvw,
+ * o ponto (2v + u + w) / 4 esta no interior do triangulo e, portanto, da regiao. caso
+ * contrario, o vertice q do triangulo mais distante da reta uw e o mais proximo de v, e o
+ * ponto medio de vq esta no interior da regiao (nenhuma aresta cruza o segmento vq).
+ *
+ * @param ring contorno externo (simples, com pelo menos 3 vertices)
+ * @param holes furos validos (simples, dentro do contorno e sem tocar outros aneis)
+ * @return ponto interior com as coordenadas multiplicadas por INTERIOR_SCALE
+ */
+Point interior_point(const std::vector<Point>& ring, const std::vector<std::vector<Point>>& holes) {
+    const int n = ring.size();
+
+    int lowest = 0;
+    for (int i = 1; i < n; ++i) {
+        if (ring[i].y < ring[lowest].y ||
+            (ring[i].y == ring[lowest].y && ring[i].x < ring[lowest].x)) {
+            lowest = i;
+        }
+    }
+
+    const Point& v = ring[lowest];
+    const Point& u = ring[(lowest + n - 1) % n];
+    const Point& w = ring[(lowest + 1) % n];
+    const Orientation turn = orientation(u, v, w);
+
+    // vertice dentro do triangulo uvw (bordas incluidas) mais distante da reta uw
+    bool found = false;
+    long long best_distance = 0;
+    Point best = v;
+
+    auto consider = [&](const Point& q) {
+        Orientation o1 = orientation(u, v, q);
+        Orientation o2 = orientation(v, w, q);
+        Orientation o3 = orientation(w, u, q);
+        if ((o1 != turn && o1 != Orientation::COLINEAR) ||
+            (o2 != turn && o2 != Orientation::COLINEAR) ||
+            (o3 != turn && o3 != Orientation::COLINEAR)) {
+            return;
+        }
+
+        long long distance = (w.x - u.x) * (q.y - u.y) - (q.x - u.x) * (w.y - u.y);
+        if (distance < 0) distance = -distance;
+
+        if (!found || distance > best_distance) {
+            found = true;
+            best_distance = distance;
+            best = q;
+        }
+    };
+
+    for (int i = 0; i < n; ++i) {
+        if (i != lowest && i != (lowest + n - 1) % n && i != (lowest + 1) % n) {
+            consider(ring[i]);
+        }
+    }
+    for (const auto& hole : holes) {
+        for (const Point& q : hole) {
+            consider(q);
+        }
+    }
+
+    if (!found) {
+        return {2 * v.x + u.x + w.x, 2 * v.y + u.y + w.y};
+    }
+    return {2 * (v.x + best.x), 2 * (v.y + best.y)};
+}
+
+// coordenadas escaladas em 128 bits: multiplicadas por scale, as diferencas entre
+// coordenadas da entrada deixam de caber no produto vetorial em long long
+typedef __int128 ScaledCoord;
+
+struct ScaledPoint {
+    ScaledCoord x, y;
+};
+
+// escala o vertice i do anel (com volta ao inicio)
+static ScaledPoint scaled_vertex(const std::vector<Point>& ring, int i, long long scale) {
+    const Point& p = ring[i % ring.size()];
+    return {static_cast<ScaledCoord>(p.x) * scale, static_cast<ScaledCoord>(p.y) * scale};
+}
+
+// produto vetorial (b - a) x (p - a): > 0 se p esta a esquerda de a->b, 0 se colinear
+static ScaledCoord scaled_cross(const ScaledPoint& a, const ScaledPoint& b, const ScaledPoint& p) {
+    return (b.x - a.x) * (p.y - a.y) - (p.x - a.x) * (b.y - a.y);
+}
+
+// on_ring_border para um ponto racional (point / scale)
+bool on_ring_border_scaled(const Point& point, long long scale,
+                                  const std::vector<Point>& ring) {
+    const int n = ring.size();
+    const ScaledPoint p = {point.x, point.y};
+
+    for (int i = 0; i < n; i++) {
+        const ScaledPoint a = scaled_vertex(ring, i, scale);
+        const ScaledPoint b = scaled_vertex(ring, i + 1, scale);
+
+        if (scaled_cross(a, b, p) == 0 &&
+            p.x <= std::max(a.x, b.x) && p.x >= std::min(a.x, b.x) &&
+            p.y <= std::max(a.y, b.y) && p.y >= std::min(a.y, b.y)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * ring_contains para um ponto racional (point / scale)
+ *
+ * o anel e escalado durante as contas (em 128 bits); fora da borda, a regra par-impar usa
+ * a paridade do numero de voltas, que coincide com a do numero de cruzamentos do ray casting.
+ *
+ * @param point coordenadas do ponto multiplicadas por scale
+ * @param scale denominador comum das coordenadas
+ * @return true se o ponto estiver dentro ou sobre o anel
+ */
+bool ring_contains_scaled(const Point& point, long long scale, const std::vector<Point>& ring,
+                          FillRule rule) {
+    const int n = ring.size();
+    if (n < 3) {
+        return false;
+    }
+
+    if (on_ring_border_scaled(point, scale, ring)) {
+        return true;
+    }
+
+    // mesmas contas de winding_number, com o anel escalado
+    const ScaledPoint p = {point.x, point.y};
+    int winding = 0;
+    for (int i = 0; i < n; i++) {
+        const ScaledPoint a = scaled_vertex(ring, i, scale);
+        const ScaledPoint b = scaled_vertex(ring, i + 1, scale);
+
+        ScaledCoord side = scaled_cross(a, b, p);
+
+        if (a.y <= p.y) {
+            if (b.y > p.y && side > 0) {
+                ++winding;
+            }
+        } else {
+            if (b.y <= p.y && side < 0) {
+                --winding;
+            }
+        }
+    }
+
+    return (rule == FillRule::NONZERO) ? winding != 0 : winding % 2 != 0;
+}
+
+// contains para um ponto racional (point / scale): dentro do contorno e fora dos furos
+bool contains_scaled(const Point& point, long long scale, const Polygon& polygon, FillRule rule) {
+    if (!can_contain_points(polygon, rule)) {
+        return false;
+    }
+
+    if (!ring_contains_scaled(point, scale, polygon.vertices, rule)) {
+        return false;
+    }
+
+    for (const auto& hole : polygon.holes) {
+        if (!on_ring_border_scaled(point, scale, hole) &&
+            ring_contains_scaled(point, scale, hole, rule)) {
+            return false; // estritamente dentro de um furo
+        }
+    }
+
+    return true;
+}
+
+/**
+ * classifica os poligonos como simples/nao simples e convexo/nao convexo
+ */
+void classify_polygons(std::vector<Polygon>& polygons) {
+    for (auto& polygon : polygons) {
+        // processamento especial para poligonos com menos de 3 vertices
+        if (polygon.vertices.size() < 3) {
+            polygon.type = PolygonType::NOT_SIMPLE;
+            polygon.is_simple = false;
+            continue;
+        }
+
+        // verificar se o poligono e simples (sem auto-intersecoes, inclusive entre furos e contorno)
+        polygon.is_simple = is_simple(polygon) && holes_are_valid(polygon);
+        
+        if (!polygon.is_simple) {
+            polygon.type = PolygonType::NOT_SIMPLE;
+        } else {
+            // uma regiao com furos nunca e convexa
+            if (polygon.holes.empty() && is_convex(polygon)) {
+                polygon.type = PolygonType::SIMPLE_CONVEX;
+            } else {
+                polygon.type = PolygonType::SIMPLE_NON_CONVEX;
+            }
+        }
+    }
+}
+
+void resize_holes(Polygon& polygon, size_t count, std::vector<std::vector<Point>>* spare) {
+    std::vector<std::vector<Point>>& holes = polygon.holes;
+
+    if (spare) {
+        while (holes.size() > count) {
+            spare->push_back(std::move(holes.back()));
+            holes.pop_back();
+        }
+        while (holes.size() < count && !spare->empty()) {
+            holes.push_back(std::move(spare->back()));
+            spare->pop_back();
+        }
+    }
+    holes.resize(count);
+}
+
+// le um anel (numero de vertices seguido das coordenadas), reaproveitando a capacidade de ring
+void read_ring(std::istream& in, std::vector<Point>& ring) {
+    int num_vertices = 0;
+    in >> num_vertices;
+
+    // contagem negativa invalida a leitura em vez de alocar um vetor enorme
+    if (num_vertices < 0) {
+        in.setstate(std::ios::failbit);
+        ring.clear();
+        return;
+    }
+
+    // a contagem vem da entrada: o anel cresce conforme os vertices sao lidos, para que
+    // uma contagem enorme sem coordenadas falhe sem alocar (clear mantem a capacidade)
+    ring.clear();
+    Point point;
+    for (int j = 0; j < num_vertices && in >> point.x >> point.y; ++j) {
+        ring.push_back(point);
+    }
+}
+
+/**
+ * le os dados dos poligonos de um stream (entrada padrao no executavel, buffer na biblioteca)
+ * em caso de erro de formato o stream fica em estado de falha
+ *
+ * os poligonos ja existentes em polygons sao reaproveitados: vetores de vertices e de
+ * furos mantem a capacidade, e lotes que nao crescem sao lidos sem alocar memoria.
+ * furos que sobram vao para spare_holes, se dado, e sao usados antes de criar aneis novos.
+ * nenhuma contagem da entrada e usada para reservar memoria de antemao; se a leitura
+ * falhar, polygons fica apenas com os poligonos lidos ate o erro.
+ *
+ * @param in stream de entrada
+ * @param count numero de poligonos a serem lidos
+ * @param read_holes se verdadeiro, cada contorno e seguido do numero de furos e dos aneis de cada furo
+ * @param polygons saida: os poligonos lidos da entrada
+ * @param spare_holes aneis de furos fora de uso (opcional)
+ */
+void read_polygons(std::istream& in, int count, bool read_holes, std::vector<Polygon>& polygons,
+                   std::vector<std::vector<Point>>* spare_holes) {
+    // como nos aneis, poligonos e furos sao criados a medida que a entrada os traz
+    int read = 0;
+    for (; read < count && in; ++read) {
+        if (static_cast<size_t>(read) == polygons.size()) {
+            polygons.emplace_back();
+        }
+        Polygon& polygon = polygons[read];
+        polygon.id = read + 1;  // indexado em 1 para corresponder a especificacao
+
+        // le vertices do poligono
+        read_ring(in, polygon.vertices);
+
+        int num_holes = 0;
+        if (read_holes) {
+            in >> num_holes;
+            if (num_holes < 0) {
+                in.setstate(std::ios::failbit);
+                num_holes = 0;
+            }
+        }
+
+        int holes_read = 0;
+        for (; holes_read < num_holes && in; ++holes_read) {
+            if (static_cast<size_t>(holes_read) == polygon.holes.size()) {
+                resize_holes(polygon, holes_read + 1, spare_holes);
+            }
+            read_ring(in, polygon.holes[holes_read]);
+        }
+        resize_holes(polygon, holes_read, spare_holes);
+        
+        // valor padrao, sera atualizado na classificacao
+        polygon.is_simple = false;
+        polygon.type = PolygonType::NOT_SIMPLE;
+    }
+
+    polygons.resize(read);
+}
+
+std::vector<Polygon> read_polygons(std::istream& in, int count, bool read_holes) {
+    std::vector<Polygon> polygons;
+    read_polygons(in, count, read_holes, polygons);
+    return polygons;
+}
+
+} // namespace polygonpoint
@@ -3,6 +3,9 @@
 
 #include <vector>
 #include <string>
+#include <iosfwd>
+
+namespace polygonpoint {
 
 enum class PolygonType {
     NOT_SIMPLE,         // "nao simples"
@@ -34,11 +37,91 @@ struct Point {
     long long x, y;
 };
 
+// regra de preenchimento usada no teste de contencao
+enum class FillRule {
+    EVEN_ODD,  // paridade (ray casting), regra original
+    NONZERO    // numero de voltas (winding number) diferente de zero
+};
+
 struct Polygon {
     int id;
-    std::vector<Point> vertices;
+    std::vector<Point> vertices;             // contorno externo
+    std::vector<std::vector<Point>> holes;   // furos (vazio na entrada padrao)
     PolygonType type;
     bool is_simple;
 };
 
+// caixa delimitadora alinhada aos eixos
+struct BoundingBox {
+    long long min_x, min_y, max_x, max_y;
+};
+
+// caixa delimitadora de um anel nao vazio
+inline BoundingBox ring_bounds(const std::vector<Point>& ring) {
+    BoundingBox box = {ring[0].x, ring[0].y, ring[0].x, ring[0].y};
+    for (const Point& p : ring) {
+        if (p.x < box.min_x) box.min_x = p.x;
+        if (p.x > box.max_x) box.max_x = p.x;
+        if (p.y < box.min_y) box.min_y = p.y;
+        if (p.y > box.max_y) box.max_y = p.y;
+    }
+    return box;
+}
+
+// caixas que se tocam na borda tambem contam como sobrepostas
+inline bool boxes_overlap(const BoundingBox& a, const BoundingBox& b) {
+    return a.min_x <= b.max_x && b.min_x <= a.max_x &&
+           a.min_y <= b.max_y && b.min_y <= a.max_y;
+}
+
+// pontos sobre a borda da caixa contam como dentro
+inline bool box_contains(const BoundingBox& box, const Point& point) {
+    return box.min_x <= point.x && point.x <= box.max_x &&
+           box.min_y <= point.y && point.y <= box.max_y;
+}
+
+// predicados geometricos (geometry.cpp)
+Orientation orientation(Point p, Point q, Point r);
+bool on_segment(Point p, Point q, Point r);
+bool do_intersect(const Point& p1, const Point& q1, const Point& p2, const Point& q2);
+bool is_simple(const Polygon& poly);
+bool is_simple_ring(const std::vector<Point>& ring);
+bool is_convex(const Polygon& poly);
+bool is_inside(const Point& point, const Polygon& polygon);
+bool is_inside_ring(const Point& point, const std::vector<Point>& ring);
+
+// aneis, furos e regra nao-zero
+bool on_ring_border(const Point& point, const std::vector<Point>& ring);
+int winding_number(const Point& point, const std::vector<Point>& ring);
+bool is_inside_winding(const Point& point, const std::vector<Point>& ring);
+bool ring_contains(const Point& point, const std::vector<Point>& ring, FillRule rule);
+bool can_contain_points(const Polygon& polygon, FillRule rule);
+bool contains(const Point& point, const Polygon& polygon, FillRule rule);
+bool rings_intersect(const std::vector<Point>& a, const std::vector<Point>& b);
+bool holes_are_valid(const Polygon& poly);
+long long ring_area2(const std::vector<Point>& ring);
+
+// pontos interiores com coordenadas racionais (x/scale, y/scale), que nem sempre caem na grade
+const long long INTERIOR_SCALE = 4;
+Point interior_point(const std::vector<Point>& ring, const std::vector<std::vector<Point>>& holes);
+bool on_ring_border_scaled(const Point& point, long long scale, const std::vector<Point>& ring);
+bool ring_contains_scaled(const Point& point, long long scale, const std::vector<Point>& ring,
+                          FillRule rule);
+bool contains_scaled(const Point& point, long long scale, const Polygon& polygon, FillRule rule);
+
+// preenche type e is_simple de cada poligono
+void classify_polygons(std::vector<Polygon>& polygons);
+
+// ajusta o numero de furos sem destruir aneis: os excedentes vao para spare (com a
+// capacidade) e voltam de la quando o poligono precisa de mais furos; sem spare, resize
+void resize_holes(Polygon& polygon, size_t count, std::vector<std::vector<Point>>* spare);
+
+// leitura no formato de entrada (numero de vertices seguido das coordenadas)
+void read_ring(std::istream& in, std::vector<Point>& ring);
+void read_polygons(std::istream& in, int count, bool read_holes, std::vector<Polygon>& polygons,
+                   std::vector<std::vector<Point>>* spare_holes = nullptr);
+std::vector<Polygon> read_polygons(std::istream& in, int count, bool read_holes);
+
+} // namespace polygonpoint
+
 #endif // GEOMETRY_H 
\ No newline at end of file
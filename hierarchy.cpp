@@ -0,0 +1,162 @@
+#include <algorithm>
+#include "hierarchy.h"
+
+namespace polygonpoint {
+
+// ponto do interior de um poligono (escalado por INTERIOR_SCALE) usado nos testes de
+// aninhamento. poligonos de area nula (vertices colineares) nao tem interior, e para
+// poligonos nao simples (regra nao-zero) o ponto calculado pode nao pertencer ao poligono;
+// nesses casos o teste volta a usar os vertices (ok = false).
+static Point nesting_point(const Polygon& polygon, FillRule rule, bool& ok) {
+    Point point = interior_point(polygon.vertices, polygon.holes);
+    ok = ring_area2(polygon.vertices) > 0 && contains_scaled(point, INTERIOR_SCALE, polygon, rule);
+    return point;
+}
+
+/**
+ * verifica se o poligono inner esta dentro da regiao de outer
+ *
+ * numa familia laminar as bordas podem se tocar, entao vertices de inner sobre a borda
+ * de outer nao bastam (inner pode estar do lado de fora, num entalhe de outer). o teste
+ * usa um ponto estritamente interior a inner. alem disso, um poligono que envolve um furo
+ * de outer nao esta aninhado nele (entrada nao laminar, que se sobrepoe ao furo).
+ *
+ * @param inner_point ponto interior de inner, escalado por INTERIOR_SCALE
+ * @param has_inner_point falso se inner_point nao e confiavel (usa os vertices de inner)
+ */
+static bool polygon_within(const Polygon& inner, const Point& inner_point, bool has_inner_point,
+                           const Polygon& outer, FillRule rule) {
+    if (has_inner_point) {
+        if (!contains_scaled(inner_point, INTERIOR_SCALE, outer, rule)) {
+            return false;
+        }
+    } else {
+        for (const Point& p : inner.vertices) {
+            if (!contains(p, outer, rule)) {
+                return false;
+            }
+        }
+    }
+
+    for (const auto& hole : outer.holes) {
+        Point hole_point = interior_point(hole, {});
+        if (contains_scaled(hole_point, INTERIOR_SCALE, inner, rule)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * constroi a floresta de contencao
+ *
+ * os poligonos sao inseridos em ordem decrescente de area do contorno externo, de modo
+ * que um poligono nunca contem outro inserido antes dele. cada insercao desce a partir
+ * das raizes pelo unico filho que contem o novo poligono, ate nao haver mais nenhum.
+ * o aninhamento e decidido por um ponto interior do novo poligono (ver polygon_within).
+ *
+ * @param polygons poligonos ja classificados
+ * @param rule regra de preenchimento usada nos testes de contencao
+ * @param arena onde ficam os vetores da hierarquia (nullptr: heap)
+ * @return hierarquia indexada pela posicao do poligono no vetor
+ */
+ContainmentHierarchy build_hierarchy(const std::vector<Polygon>& polygons, FillRule rule,
+                                     Arena* arena) {
+    const int m = polygons.size();
+    ArenaAllocator<int> allocator(arena);
+
+    ContainmentHierarchy hierarchy;
+    hierarchy.rule = rule;
+    hierarchy.first_child = ArenaVector<int>(m, -1, allocator);
+    hierarchy.next_sibling = ArenaVector<int>(m, -1, allocator);
+    hierarchy.parent = ArenaVector<int>(m, -1, allocator);
+    hierarchy.depth = ArenaVector<int>(m, -1, allocator);
+    hierarchy.bounds = ArenaVector<BoundingBox>(ArenaAllocator<BoundingBox>(arena));
+    hierarchy.bounds.resize(m, BoundingBox{0, 0, -1, -1}); // caixa vazia para os excluidos
+
+    // ultimo filho de cada no (e das raizes, na posicao m), para inserir no fim da lista
+    ArenaVector<int> last_child(m + 1, -1, allocator);
+
+    ArenaVector<int> order(allocator);
+    ArenaVector<long long> area2(m, 0, ArenaAllocator<long long>(arena));
+    order.reserve(m);
+    for (int i = 0; i < m; ++i) {
+        if (can_contain_points(polygons[i], rule)) {
+            order.push_back(i);
+            area2[i] = ring_area2(polygons[i].vertices);
+            hierarchy.bounds[i] = ring_bounds(polygons[i].vertices);
+        }
+    }
+
+    // maiores primeiro, ordem de entrada em caso de empate
+    // (std::sort com desempate pelo indice: stable_sort alocaria um buffer temporario)
+    std::sort(order.begin(), order.end(), [&area2](int a, int b) {
+        return (area2[a] != area2[b]) ? area2[a] > area2[b] : a < b;
+    });
+
+    for (int idx : order) {
+        const Polygon& polygon = polygons[idx];
+        bool has_point = false;
+        const Point point = nesting_point(polygon, rule, has_point);
+        int parent = -1;
+        int candidate = hierarchy.first_root;
+
+        // descer enquanto algum no do nivel atual contiver o poligono
+        while (candidate != -1) {
+            if (polygon_within(polygon, point, has_point, polygons[candidate], rule)) {
+                parent = candidate;
+                candidate = hierarchy.first_child[candidate];
+            } else {
+                candidate = hierarchy.next_sibling[candidate];
+            }
+        }
+
+        // inserir no fim da lista de filhos do pai (ou das raizes)
+        int& last = last_child[(parent < 0) ? m : parent];
+        if (last != -1) {
+            hierarchy.next_sibling[last] = idx;
+        } else if (parent < 0) {
+            hierarchy.first_root = idx;
+        } else {
+            hierarchy.first_child[parent] = idx;
+        }
+        last = idx;
+
+        hierarchy.parent[idx] = parent;
+        hierarchy.depth[idx] = (parent < 0) ? 0 : hierarchy.depth[parent] + 1;
+    }
+
+    return hierarchy;
+}
+
+/**
+ * encontra o poligono mais interno que contem o ponto
+ *
+ * percorre apenas o caminho da raiz ate a folha: em cada nivel testa os irmaos ate
+ * achar um que contenha o ponto e desce para os filhos dele. numa familia laminar,
+ * se o ponto nao esta num no, tambem nao esta em nenhum descendente. irmaos cuja
+ * caixa nao tem o ponto sao descartados sem percorrer os vertices.
+ *
+ * @return id (indexado em 1) do poligono mais interno, ou 0 se nenhum contem o ponto
+ */
+int find_innermost_polygon(const ContainmentHierarchy& hierarchy,
+                           const std::vector<Polygon>& polygons,
+                           const Point& point) {
+    int innermost = -1;
+    int candidate = hierarchy.first_root;
+
+    while (candidate != -1) {
+        if (box_contains(hierarchy.bounds[candidate], point) &&
+            contains(point, polygons[candidate], hierarchy.rule)) {
+            innermost = candidate;
+            candidate = hierarchy.first_child[candidate];
+        } else {
+            candidate = hierarchy.next_sibling[candidate];
+        }
+    }
+
+    return (innermost < 0) ? 0 : polygons[innermost].id;
+}
+
+} // namespace polygonpoint
@@ -0,0 +1,38 @@
+#ifndef HIERARCHY_H
+#define HIERARCHY_H
+
+#include <vector>
+#include "arena.h"
+#include "geometry.h"
+
+namespace polygonpoint {
+
+// floresta de contencao entre poligonos, construida uma vez na carga.
+// supoe uma familia laminar: dois poligonos quaisquer sao aninhados ou disjuntos
+// (bordas podem se tocar, mas nao se cruzar).
+// filhos ficam em listas encadeadas (first_child/next_sibling) em vetores planos,
+// que podem morar numa Arena junto com os demais indices; cada no guarda a caixa do
+// seu contorno, de modo que a consulta so chama contains nos irmaos cuja caixa tem o ponto.
+struct ContainmentHierarchy {
+    FillRule rule;
+    int first_root = -1;             // indice da primeira raiz (-1 se vazia)
+    ArenaVector<int> first_child;    // primeiro filho, por indice de poligono (-1 se nenhum)
+    ArenaVector<int> next_sibling;   // proximo irmao (-1 se ultimo)
+    ArenaVector<int> parent;         // indice do pai (-1 para raizes e excluidos)
+    ArenaVector<int> depth;          // profundidade na floresta (-1 se excluido)
+    ArenaVector<BoundingBox> bounds; // caixa do contorno externo, para descartar irmaos
+};
+
+// constroi a hierarquia com os poligonos que podem conter pontos na regra dada;
+// com arena, os vetores do indice e os temporarios da construcao ficam nela
+ContainmentHierarchy build_hierarchy(const std::vector<Polygon>& polygons, FillRule rule,
+                                     Arena* arena = nullptr);
+
+// id do poligono mais interno que contem o ponto (0 se nenhum)
+int find_innermost_polygon(const ContainmentHierarchy& hierarchy,
+                           const std::vector<Polygon>& polygons,
+                           const Point& point);
+
+} // namespace polygonpoint
+
+#endif // HIERARCHY_H
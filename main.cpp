@@ -3,289 +3,119 @@
 #include <string>
 #include <algorithm>
 #include <limits>
-#include "geometry.h" // structs polygon e point
-#include "desenha.h"  // script gnuplot
+#include <iomanip>
+#include "geometry.h"  // structs polygon e point
+#include "hierarchy.h" // hierarquia de contencao
+#include "relations.h" // relacoes entre pares de poligonos
+#include "nearest.h"   // indice de arestas e poligono mais proximo
+#include "arena.h"     // alocador dos indices
+#include "desenha.h"   // script gnuplot
+
+using namespace polygonpoint;
+
+// opcoes de linha de comando
+struct Options {
+    FillRule rule = FillRule::EVEN_ODD; // --nao-zero
+    bool read_holes = false;            // --furos
+    bool innermost_only = false;        // --hierarquia
+    bool relations = false;             // --relacoes
+    bool nearest = false;               // --distancia
+    bool draw = true;                   // --sem-desenho
+};
 
 /**
- * calcula a orientacao entre 3 pontos (p, q, r)
+ * interpreta os argumentos de linha de comando
  *
- * @param p, q, r  pontos
- * @return COLINEAR || ANTIHORARIO || HORARIO
+ * @return false se algum argumento for desconhecido
  */
-Orientation orientation(Point p, Point q, Point r) {
-    // cross product 2D
-    long long val = (q.y - p.y) * (r.x - q.x) - (q.x - p.x) * (r.y - q.y);
-
-    if (val == 0) return Orientation::COLINEAR; // colinear
-
-    return (val > 0) ? Orientation::ANTIHORARIO : Orientation::HORARIO;
-}
-
-// verifica se o ponto q esta no segmento pr (assumindo colinearidade)
-bool on_segment(Point p, Point q, Point r) {
-    return (q.x <= std::max(p.x, r.x) && q.x >= std::min(p.x, r.x) &&
-            q.y <= std::max(p.y, r.y) && q.y >= std::min(p.y, r.y));
-}
-
-/**
- * verifica se dois segmentos de reta se intersectam.
- *
- * @param p1 primeiro ponto do primeiro segmento
- * @param q1 segundo ponto do primeiro segmento
- * @param p2 primeiro ponto do segundo segmento
- * @param q2 segundo ponto do segundo segmento
- * @return boolean << se os segmentos se intersectam
- */
-bool do_intersect(const Point& p1, const Point& q1, const Point& p2, const Point& q2) {
-    // verificar as 4 orientacoes necessarias
-    Orientation o1 = orientation(p1, q1, p2);
-    Orientation o2 = orientation(p1, q1, q2);
-    Orientation o3 = orientation(p2, q2, p1);
-    Orientation o4 = orientation(p2, q2, q1);
-    
-    // caso geral: se para cada segmento os dois pontos do outro segmento estao em sentidos opostos os segmentos se cruzam
-    if (o1 != o2 && o3 != o4) {
-        return true;
-    }
-    
-    // casos especiais: se um ponto tem orientacao colinear com o segmento, checamos se esta dentro dos "limites" do segmento 
-    if (o1 == Orientation::COLINEAR && on_segment(p1, p2, q1)) return true;
-    if (o2 == Orientation::COLINEAR && on_segment(p1, q2, q1)) return true;
-    if (o3 == Orientation::COLINEAR && on_segment(p2, p1, q2)) return true;
-    if (o4 == Orientation::COLINEAR && on_segment(p2, q1, q2)) return true;
-    
-    return false;
-}
-
-
-/**
- * verifica se um poligono e simples (sem auto-intersecoes)
- * um poligono e considerado simples se:
- * 1. tem pelo menos 3 vertices
- * 2. nao possui arestas nao-adjacentes que se interceptam
- */
-bool is_simple(const Polygon& poly) {
-    int n = poly.vertices.size();
-    
-    if (n < 3) {
-        return false; // poligonos com menos de 3 vertices nao sao simples por definicao
-    }
-
-    // verifica se ha intersecoes entre arestas nao-adjacentes
-    for (int i = 0; i < n; ++i) {
-        Point p1 = poly.vertices[i];
-        Point q1 = poly.vertices[(i + 1) % n]; // proximo vertice (% usa vetor como anel)
-
-        // verificar contra todas as outras arestas nao-adjacentes
-        for (int j = i + 2; j < n; ++j) {
-
-            if ((j + 1) % n == i) {
-                continue; // arestas adjacentes (ultima e primeira)
-            }
-
-            Point p2 = poly.vertices[j];
-            Point q2 = poly.vertices[(j + 1) % n];
-
-            // verificar interseccao
-            if (do_intersect(p1, q1, p2, q2)) {
-                return false; // encontrada interseccao entre arestas nao-adjacentes
-            }
-        }
-    }
-
-    return true; // nenhuma interseccao encontrada
-}
-
-/**
- * verifica se um poligono simples e convexo
- * um poligono e convexo se todos os angulos internos sao menores ou iguais a 180 graus.
- * matematicamente, isso significa que todas as "viradas" devem ser na mesma direcao.
- */
-bool is_convex(const Polygon& poly) {
-    int n = poly.vertices.size();
-    
-    // verificacoes preliminares
-    if (n < 3) {
-        return false; // nao e um poligono valido
-    }
-    
-    // para um poligono ser convexo, todas as orientacoes entre 3 pontos sequenciais devem ser a mesma
-    // primeiro, encontra a primeira orientacao nao-colinear para usar como referencia
-    Orientation reference_orientation = Orientation::COLINEAR;
-    bool has_orientation = false;
-    
-    // encontrar a primeira orientacao nao-colinear
-    for (int i = 0; i < n && !has_orientation; ++i) {
-        Point p1 = poly.vertices[i];
-        Point p2 = poly.vertices[(i + 1) % n];
-        Point p3 = poly.vertices[(i + 2) % n];
-        
-        Orientation orient = orientation(p1, p2, p3);
-        if (orient != Orientation::COLINEAR) {
-            reference_orientation = orient;
-            has_orientation = true;
-        }
-    }
-    
-    // se todos os pontos sao colineares, consideramos convexo (e um segmento de reta)
-    if (!has_orientation) {
-        return true;
-    }
-    
-    // agora verificamos se todas as orientacoes sao iguais a referencia ou colineares
-    for (int i = 0; i < n; ++i) {
-        Point p1 = poly.vertices[i];
-        Point p2 = poly.vertices[(i + 1) % n];
-        Point p3 = poly.vertices[(i + 2) % n];
-        
-        Orientation orient = orientation(p1, p2, p3);
-        
-        // se encontrarmos uma orientacao diferente da referencia e nao-colinear, nao e convexo
-        if (orient != Orientation::COLINEAR && orient != reference_orientation) {
+bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if (arg == "--nao-zero") {
+            options.rule = FillRule::NONZERO;
+        } else if (arg == "--furos") {
+            options.read_holes = true;
+        } else if (arg == "--hierarquia") {
+            options.innermost_only = true;
+        } else if (arg == "--relacoes") {
+            options.relations = true;
+        } else if (arg == "--distancia") {
+            options.nearest = true;
+        } else if (arg == "--sem-desenho") {
+            options.draw = false;
+        } else {
+            std::cerr << "Erro: opcao desconhecida '" << arg << "'" << std::endl;
             return false;
         }
     }
-    
-    return true; // todas as orientacoes sao consistentes, o poligono e convexo
+    return true;
 }
 
+// poligonos que contem cada ponto, em dois vetores planos (formato CSR):
+// os ids do ponto i ficam em ids[offsets[i] .. offsets[i + 1])
+struct PointContainers {
+    std::vector<int> offsets;
+    std::vector<int> ids;
+};
 
 /**
- * verifica se um ponto esta dentro de um poligono simples
- * 
- * implementa o algoritmo de ray casting (parity method):
- * - traca um raio horizontal a partir do ponto
- * - conta as intersecoes com as arestas do poligono
- * - numero impar de intersecoes: ponto esta dentro
- * - numero par de intersecoes: ponto esta fora
- * - pontos sobre arestas ou vertices sao considerados dentro
- *
- * @param point o ponto a ser verificado
- * @param polygon o poligono a ser testado
- * @return true se o ponto estiver dentro ou sobre o poligono, false caso contrario
- */
-bool is_inside(const Point& point, const Polygon& polygon) {
-    // poligonos nao-simples ou com menos de 3 vertices nao contem pontos
-    if (!polygon.is_simple || polygon.vertices.size() < 3) {
-        return false;
-    }
-
-    const int n = polygon.vertices.size();
-
-    // comecamos com false e vamos invertendo a variavel a cada interseccao encontrada (%2)
-    bool inside = false;
-    
-    // primeiro, verificar se o ponto esta sobre alguma aresta ou vertice
-    for (int i = 0; i < n; i++) {
-        const Point& current = polygon.vertices[i];
-        const Point& next = polygon.vertices[(i + 1) % n];
-        
-        // verificar se o ponto esta sobre um vertice
-        if (point.x == current.x && point.y == current.y) {
-            return true;
-        }
-        
-        // verificar se o ponto esta sobre uma aresta
-        if (orientation(current, point, next) == Orientation::COLINEAR && 
-            on_segment(current, point, next)) {
-            return true;
-        }
-    }
-    
-    // implementacao do algoritmo ray casting
-    for (int i = 0, j = n - 1; i < n; j = i++) {
-        const Point& vi = polygon.vertices[i];
-        const Point& vj = polygon.vertices[j];
-        
-        // condicao para verificar se a aresta cruza o raio horizontal
-        bool cross_x_ray = (vi.y > point.y) != (vj.y > point.y);
-        
-        // se a aresta nao cruza horizontalmente, pule para a proxima aresta
-        if (!cross_x_ray) continue;
-
-        // a partir daqui, sabemos que o ponto esta no range vertical do segmento
-        
-        // verificar se a interseccao esta a direita do ponto
-        // caso especial: aresta vertical
-        if (vi.x == vj.x) {
-            if (vi.x > point.x) {
-                inside = !inside;
-            }
-            continue;
-        }
-        
-        // caso geral: calcular a interseccao
-        // evitar divisao por zero (embora ja deveria estar garantido por cross_x_ray)
-        if (vj.y - vi.y == 0) continue;
-        
-        // calcular o ponto x onde a aresta cruza o raio horizontal
-        double x_intersect = static_cast<double>(vj.x - vi.x) * (point.y - vi.y) / (vj.y - vi.y) + vi.x;
-        
-        // se a interseccao esta a direita do ponto, inverte o estado
-        if (x_intersect > point.x) {
-            inside = !inside;
-        }
-    }
-    
-    return inside;
-}
-
-/**
- * encontra quais poligonos simples contem cada ponto
+ * encontra quais poligonos contem cada ponto
  *
  * @param polygons lista de poligonos a serem verificados
  * @param points lista de pontos a serem testados
- * @return vetor de vetores (indexado por ponto) com os ids dos poligonos que contem cada ponto
+ * @param rule regra de preenchimento (par-impar considera apenas poligonos simples)
+ * @param result saida: ids dos poligonos que contem cada ponto (reaproveita a capacidade)
  */
-std::vector<std::vector<int>> find_containing_polygons(
+void find_containing_polygons(
     const std::vector<Polygon>& polygons,
-    const std::vector<Point>& points) {
+    const std::vector<Point>& points,
+    FillRule rule,
+    PointContainers& result) {
     
     int num_points = points.size();
-    std::vector<std::vector<int>> result(num_points);
+    result.offsets.resize(num_points + 1);
+    result.ids.clear();
     
     // para cada ponto, testar inclusao em cada poligono
     for (int i = 0; i < num_points; ++i) {
         const Point& point = points[i];
+        result.offsets[i] = result.ids.size();
         
         for (const Polygon& polygon : polygons) {
-            // testar apenas em poligonos simples (conforme especificacao)
-            if (polygon.is_simple && is_inside(point, polygon)) {
+            // contains descarta poligonos nao simples na regra par-impar (conforme especificacao)
+            if (contains(point, polygon, rule)) {
                 // adicionar o id do poligono (1-indexed)
-                result[i].push_back(polygon.id);
+                result.ids.push_back(polygon.id);
             }
         }        
     }
-    
-    return result;
+    result.offsets[num_points] = result.ids.size();
 }
 
 /**
- * le os dados dos poligonos da entrada padrao
+ * encontra o poligono mais interno que contem cada ponto, percorrendo a hierarquia
  *
- * @param count numero de poligonos a serem lidos
- * @return um vetor de poligonos lidos da entrada
+ * @param result saida: no maximo um id por ponto (nenhum se nenhum poligono contem o ponto)
  */
-std::vector<Polygon> read_polygons(int count) {
-    std::vector<Polygon> polygons(count);
-    
-    for (int i = 0; i < count; ++i) {
-        polygons[i].id = i + 1;  // indexado em 1 para corresponder a especificacao
-        int num_vertices;
-        std::cin >> num_vertices;
-        
-        // le vertices do poligono
-        polygons[i].vertices.resize(num_vertices);
-        for (int j = 0; j < num_vertices; ++j) {
-            std::cin >> polygons[i].vertices[j].x >> polygons[i].vertices[j].y;
+void find_innermost_polygons(
+    const std::vector<Polygon>& polygons,
+    const std::vector<Point>& points,
+    const ContainmentHierarchy& hierarchy,
+    PointContainers& result) {
+
+    int num_points = points.size();
+    result.offsets.resize(num_points + 1);
+    result.ids.clear();
+
+    for (int i = 0; i < num_points; ++i) {
+        result.offsets[i] = result.ids.size();
+        int polygon_id = find_innermost_polygon(hierarchy, polygons, points[i]);
+        if (polygon_id != 0) {
+            result.ids.push_back(polygon_id);
         }
-        
-        // valor padrao, sera atualizado na classificacao
-        polygons[i].is_simple = false;
-        polygons[i].type = PolygonType::NOT_SIMPLE;
     }
-    
-    return polygons;
+    result.offsets[num_points] = result.ids.size();
 }
 
 /**
@@ -305,58 +135,81 @@ std::vector<Point> read_points(int count) {
 }
 
 /**
- * classifica os poligonos como simples/nao simples e convexo/nao convexo
+ * encontra, para cada ponto, o poligono de referencia da distancia ate a borda
+ *
+ * pontos contidos usam o poligono que os contem com a borda mais proxima (o mais interno);
+ * pontos fora de todos os poligonos, o mais proximo. nos dois casos a busca e feita no
+ * indice de arestas (find_reference_border), restrita aos poligonos que contem o ponto.
+ *
+ * @param containers poligonos que contem cada ponto (com --hierarquia, so o mais interno)
  */
-void classify_polygons(std::vector<Polygon>& polygons) {
-    for (auto& polygon : polygons) {
-        // processamento especial para poligonos com menos de 3 vertices
-        if (polygon.vertices.size() < 3) {
-            polygon.type = PolygonType::NOT_SIMPLE;
-            polygon.is_simple = false;
-            continue;
-        }
-
-        // verificar se o poligono e simples (sem auto-intersecoes)
-        polygon.is_simple = is_simple(polygon);
-        
-        if (!polygon.is_simple) {
-            polygon.type = PolygonType::NOT_SIMPLE;
-        } else {
-            if (is_convex(polygon)) {
-                polygon.type = PolygonType::SIMPLE_CONVEX;
-            } else {
-                polygon.type = PolygonType::SIMPLE_NON_CONVEX;
-            }
-        }
+std::vector<NearestResult> find_nearest_polygons(const SegmentIndex& index,
+                                                 const std::vector<Point>& points,
+                                                 const PointContainers& containers) {
+    std::vector<NearestResult> result(points.size());
+    NearestQueue queue; // uma fila para todas as consultas
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        const int first = containers.offsets[i];
+        const int count = containers.offsets[i + 1] - first;
+
+        result[i] = find_reference_border(index, points[i], containers.ids.data() + first, count,
+                                          &queue);
     }
+
+    return result;
 }
 
 /**
  * imprime os resultados da classificacao de poligonos e contencao de pontos
  *
  * @param polygons vetor de poligonos classificados
- * @param point_containers vetor de vetores com ids dos poligonos que contem cada ponto
+ * @param point_containers ids dos poligonos que contem cada ponto
+ * @param nearest poligono de referencia e distancia ate a borda de cada ponto (opcional),
+ *                impresso como "| id distancia^2"
  */
 void print_results(const std::vector<Polygon>& polygons, 
-                   const std::vector<std::vector<int>>& point_containers) {
+                   const PointContainers& point_containers,
+                   const std::vector<NearestResult>* nearest = nullptr) {
     // classificacao de poligonos
     for (const auto& polygon : polygons) {
         std::cout << polygon.id << " " << polygon_type_to_string(polygon.type) << std::endl;
     }
 
     // pontos
-    for (size_t i = 0; i < point_containers.size(); ++i) {
+    for (size_t i = 0; i + 1 < point_containers.offsets.size(); ++i) {
         std::cout << (i + 1) << ":";  // Ponto ID comeca em 1
         
-        for (int polygon_id : point_containers[i]) {
-            std::cout << " " << polygon_id;
+        for (int k = point_containers.offsets[i]; k < point_containers.offsets[i + 1]; ++k) {
+            std::cout << " " << point_containers.ids[k];
+        }
+
+        if (nearest && (*nearest)[i].polygon_id != 0) {
+            std::cout << " | " << (*nearest)[i].polygon_id
+                      << " " << std::setprecision(15) << (*nearest)[i].distance2;
         }
         
         std::cout << std::endl;
     }
 }
 
-int main() {
+/**
+ * imprime a lista esparsa de relacoes entre pares de poligonos
+ * (uma linha "i j relacao" por par nao disjunto)
+ */
+void print_relations(const std::vector<PolygonPair>& pairs) {
+    for (const auto& pair : pairs) {
+        std::cout << pair.first_id << " " << pair.second_id << " "
+                  << polygon_relation_to_string(pair.relation) << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        return 1;
+    }
+
     // otimizar entrada/saida
     std::ios_base::sync_with_stdio(false);
     std::cin.tie(NULL);
@@ -365,7 +218,7 @@ int main() {
     std::cin >> m >> n;
 
     // ler os poligonos da entrada
-    std::vector<Polygon> polygons = read_polygons(m);
+    std::vector<Polygon> polygons = read_polygons(std::cin, m, options.read_holes);
 
     // ler os pontos da entrada
     std::vector<Point> points = read_points(n);
@@ -374,13 +227,34 @@ int main() {
     classify_polygons(polygons);
 
     // 2. encontrar poligonos que contem cada ponto
-    std::vector<std::vector<int>> point_containers = find_containing_polygons(polygons, points);
+    //    (com --hierarquia, apenas o mais interno, percorrendo a hierarquia montada na carga)
+    //    os indices ficam numa arena, liberada de uma vez no fim
+    Arena arena;
+    PointContainers point_containers;
+    if (options.innermost_only) {
+        ContainmentHierarchy hierarchy = build_hierarchy(polygons, options.rule, &arena);
+        find_innermost_polygons(polygons, points, hierarchy, point_containers);
+    } else {
+        find_containing_polygons(polygons, points, options.rule, point_containers);
+    }
+
+    // com --distancia, distancia ate a borda do poligono mais interno que contem o ponto
+    // (ou do poligono mais proximo, para pontos fora de todos)
+    std::vector<NearestResult> nearest;
+    if (options.nearest) {
+        SegmentIndex index = build_segment_index(polygons, options.rule, &arena);
+        nearest = find_nearest_polygons(index, points, point_containers);
+    }
+
+    // 3. imprimir resultados (e, com --relacoes, as relacoes entre poligonos)
+    print_results(polygons, point_containers, options.nearest ? &nearest : nullptr);
 
-    // 3. imprimir resultados
-    print_results(polygons, point_containers);
+    if (options.relations) {
+        print_relations(find_polygon_relations(polygons, options.rule));
+    }
 
     // 4. desenhar os poligonos e pontos (se houver)
-    if (!polygons.empty() || !points.empty()) {
+    if (options.draw && (!polygons.empty() || !points.empty())) {
         draw(&polygons, &points);
     }
 
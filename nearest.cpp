@@ -0,0 +1,305 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include "nearest.h"
+
+namespace polygonpoint {
+
+// numero maximo de filhos por no da R-tree
+static const int NODE_CAPACITY = 8;
+
+static BoundingBox merge_boxes(const BoundingBox& a, const BoundingBox& b) {
+    return {std::min(a.min_x, b.min_x), std::min(a.min_y, b.min_y),
+            std::max(a.max_x, b.max_x), std::max(a.max_y, b.max_y)};
+}
+
+/**
+ * ordena os itens pelo metodo STR (sort-tile-recursive): divide em faixas verticais
+ * pelo centro em x e ordena cada faixa pelo centro em y, de modo que grupos
+ * consecutivos de NODE_CAPACITY itens fiquem espacialmente proximos
+ */
+template <typename Container>
+static void str_sort(Container& items) {
+    typedef typename Container::value_type T;
+
+    const int count = items.size();
+    const int leaves = (count + NODE_CAPACITY - 1) / NODE_CAPACITY;
+    const int slices = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(leaves))));
+    const int slice_size = slices * NODE_CAPACITY;
+
+    // centros multiplicados por 2 para continuar em inteiros
+    std::sort(items.begin(), items.end(), [](const T& a, const T& b) {
+        return a.box.min_x + a.box.max_x < b.box.min_x + b.box.max_x;
+    });
+
+    for (int start = 0; start < count; start += slice_size) {
+        int end = std::min(start + slice_size, count);
+        std::sort(items.begin() + start, items.begin() + end, [](const T& a, const T& b) {
+            return a.box.min_y + a.box.max_y < b.box.min_y + b.box.max_y;
+        });
+    }
+}
+
+static void add_ring_segments(const std::vector<Point>& ring, int polygon_id,
+                              ArenaVector<SegmentEntry>& segments) {
+    const int n = ring.size();
+
+    for (int i = 0; i < n; ++i) {
+        SegmentEntry entry;
+        entry.p = ring[i];
+        entry.q = ring[(i + 1) % n];
+        entry.box = {std::min(entry.p.x, entry.q.x), std::min(entry.p.y, entry.q.y),
+                     std::max(entry.p.x, entry.q.x), std::max(entry.p.y, entry.q.y)};
+        entry.polygon_id = polygon_id;
+        segments.push_back(entry);
+    }
+}
+
+/**
+ * constroi a R-tree de baixo para cima
+ *
+ * as arestas sao ordenadas por STR e agrupadas em folhas; cada nivel de nos e
+ * novamente ordenado por STR e agrupado no nivel de cima, ate restar um unico no.
+ * cada nivel e copiado para index.nodes ja na ordem final, o que mantem contiguos
+ * os filhos de cada no.
+ */
+SegmentIndex build_segment_index(const std::vector<Polygon>& polygons, FillRule rule,
+                                 Arena* arena) {
+    ArenaAllocator<RTreeNode> allocator(arena);
+
+    SegmentIndex index;
+    index.segments = ArenaVector<SegmentEntry>(ArenaAllocator<SegmentEntry>(arena));
+    index.nodes = ArenaVector<RTreeNode>(allocator);
+
+    // reservar de uma vez evita realocacoes (e desperdicio na arena)
+    size_t num_edges = 0;
+    for (const Polygon& polygon : polygons) {
+        if (can_contain_points(polygon, rule)) {
+            num_edges += polygon.vertices.size();
+            for (const auto& hole : polygon.holes) {
+                num_edges += hole.size();
+            }
+        }
+    }
+    index.segments.reserve(num_edges);
+
+    for (const Polygon& polygon : polygons) {
+        if (!can_contain_points(polygon, rule)) {
+            continue;
+        }
+        add_ring_segments(polygon.vertices, polygon.id, index.segments);
+        for (const auto& hole : polygon.holes) {
+            add_ring_segments(hole, polygon.id, index.segments);
+        }
+    }
+
+    if (index.segments.empty()) {
+        return index;
+    }
+
+    str_sort(index.segments);
+
+    // folhas; cada nivel tem no maximo 1/NODE_CAPACITY dos nos do anterior
+    const int num_segments = index.segments.size();
+    const int num_leaves = (num_segments + NODE_CAPACITY - 1) / NODE_CAPACITY;
+    // (folga para o arredondamento de cada nivel)
+    index.nodes.reserve(num_leaves + num_leaves / (NODE_CAPACITY - 1) + 32);
+
+    ArenaVector<RTreeNode> level(allocator);
+    ArenaVector<RTreeNode> parents(allocator);
+    level.reserve(num_leaves);
+    parents.reserve(num_leaves);
+
+    for (int start = 0; start < num_segments; start += NODE_CAPACITY) {
+        RTreeNode node;
+        node.first = start;
+        node.count = std::min(NODE_CAPACITY, num_segments - start);
+        node.leaf = true;
+        node.box = index.segments[start].box;
+        for (int i = start + 1; i < start + node.count; ++i) {
+            node.box = merge_boxes(node.box, index.segments[i].box);
+        }
+        level.push_back(node);
+    }
+
+    // niveis internos
+    while (level.size() > 1) {
+        str_sort(level);
+
+        const int base = index.nodes.size();
+        index.nodes.insert(index.nodes.end(), level.begin(), level.end());
+
+        parents.clear();
+        const int num_nodes = level.size();
+        for (int start = 0; start < num_nodes; start += NODE_CAPACITY) {
+            RTreeNode node;
+            node.first = base + start;
+            node.count = std::min(NODE_CAPACITY, num_nodes - start);
+            node.leaf = false;
+            node.box = level[start].box;
+            for (int i = start + 1; i < start + node.count; ++i) {
+                node.box = merge_boxes(node.box, level[i].box);
+            }
+            parents.push_back(node);
+        }
+
+        level.swap(parents);
+    }
+
+    index.root = index.nodes.size();
+    index.nodes.push_back(level[0]);
+
+    return index;
+}
+
+// menor distancia ao quadrado entre o ponto e a caixa (0 se estiver dentro)
+static double box_distance2(const Point& point, const BoundingBox& box) {
+    double dx = 0, dy = 0;
+    if (point.x < box.min_x) dx = static_cast<double>(box.min_x - point.x);
+    else if (point.x > box.max_x) dx = static_cast<double>(point.x - box.max_x);
+    if (point.y < box.min_y) dy = static_cast<double>(box.min_y - point.y);
+    else if (point.y > box.max_y) dy = static_cast<double>(point.y - box.max_y);
+    return dx * dx + dy * dy;
+}
+
+/**
+ * distancia ao quadrado entre um ponto e um segmento
+ *
+ * projecao e extremos calculados em inteiros; apenas a divisao final (projecao
+ * no interior do segmento) usa ponto flutuante.
+ */
+double segment_distance2(const Point& point, const Point& a, const Point& b) {
+    long long dx = b.x - a.x;
+    long long dy = b.y - a.y;
+    long long px = point.x - a.x;
+    long long py = point.y - a.y;
+
+    long long length2 = dx * dx + dy * dy;
+    long long dot = px * dx + py * dy;
+
+    // segmento degenerado ou projecao antes de a: distancia ate a
+    if (length2 == 0 || dot <= 0) {
+        return static_cast<double>(px * px + py * py);
+    }
+
+    // projecao depois de b: distancia ate b
+    if (dot >= length2) {
+        long long qx = point.x - b.x;
+        long long qy = point.y - b.y;
+        return static_cast<double>(qx * qx + qy * qy);
+    }
+
+    // projecao no interior: cross^2 / |ab|^2
+    double cross = static_cast<double>(dx * py - dy * px);
+    return cross * cross / static_cast<double>(length2);
+}
+
+/**
+ * busca best-first na R-tree, aceitando apenas as arestas que passam no filtro
+ *
+ * uma fila de prioridade ordenada pela distancia ate a caixa de cada no; a busca termina
+ * quando a caixa mais proxima ainda nao visitada esta mais longe do que a melhor aresta
+ * aceita. com filtro, nos cheios de arestas recusadas sao visitados e descartados, mas a
+ * poda continua valendo assim que uma aresta aceita aparece.
+ */
+template <typename Accept>
+static NearestResult nearest_search(const SegmentIndex& index, const Point& point,
+                                    NearestQueue* queue, Accept accept) {
+    NearestResult best = {0, 0.0};
+    if (index.root < 0) {
+        return best;
+    }
+
+    // heap minimo sobre o buffer reaproveitado (ou local)
+    NearestQueue local_queue;
+    NearestQueue& heap = queue ? *queue : local_queue;
+    std::greater<NearestQueue::value_type> closer;
+
+    heap.clear();
+    heap.push_back(std::make_pair(box_distance2(point, index.nodes[index.root].box), index.root));
+
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), closer);
+        NearestQueue::value_type item = heap.back();
+        heap.pop_back();
+
+        // nenhuma caixa restante pode ter aresta mais proxima (empates ainda sao visitados)
+        if (best.polygon_id != 0 && item.first > best.distance2) {
+            break;
+        }
+
+        const RTreeNode& node = index.nodes[item.second];
+
+        if (node.leaf) {
+            for (int i = node.first; i < node.first + node.count; ++i) {
+                const SegmentEntry& segment = index.segments[i];
+                if (!accept(segment.polygon_id)) {
+                    continue;
+                }
+
+                double d2 = segment_distance2(point, segment.p, segment.q);
+                if (best.polygon_id == 0 || d2 < best.distance2 ||
+                    (d2 == best.distance2 && segment.polygon_id < best.polygon_id)) {
+                    best.polygon_id = segment.polygon_id;
+                    best.distance2 = d2;
+                }
+            }
+        } else {
+            for (int i = node.first; i < node.first + node.count; ++i) {
+                heap.push_back(std::make_pair(box_distance2(point, index.nodes[i].box), i));
+                std::push_heap(heap.begin(), heap.end(), closer);
+            }
+        }
+    }
+
+    return best;
+}
+
+/**
+ * encontra a aresta indexada mais proxima do ponto
+ *
+ * @return id do poligono dono da aresta mais proxima e a distancia ao quadrado ate ela
+ */
+NearestResult find_nearest_polygon(const SegmentIndex& index, const Point& point,
+                                   NearestQueue* queue) {
+    return nearest_search(index, point, queue, [](int) { return true; });
+}
+
+/**
+ * encontra, entre os poligonos dados, o de borda mais proxima do ponto
+ *
+ * mesma busca de find_nearest_polygon, aceitando apenas arestas desses poligonos. para um
+ * ponto contido em varios poligonos aninhados, a borda do mais interno esta sempre mais
+ * perto (qualquer caminho ate a borda de fora cruza a de dentro).
+ *
+ * @param ids ids (indexados em 1) dos poligonos candidatos, tipicamente os que contem o ponto
+ * @return id do poligono e distancia ao quadrado ate sua borda ({0, 0} se count == 0)
+ */
+NearestResult find_nearest_polygon(const SegmentIndex& index, const Point& point,
+                                   const int* ids, int count, NearestQueue* queue) {
+    if (count == 0) {
+        return {0, 0.0};
+    }
+
+    return nearest_search(index, point, queue, [ids, count](int polygon_id) {
+        return std::find(ids, ids + count, polygon_id) != ids + count;
+    });
+}
+
+/**
+ * borda de referencia de um ponto nas consultas de distancia
+ *
+ * pontos contidos medem ate a borda mais proxima entre os poligonos que os contem (o mais
+ * interno, numa familia laminar); pontos fora de todos, ate o poligono mais proximo.
+ *
+ * @param containers ids dos poligonos que contem o ponto (ou so o mais interno)
+ */
+NearestResult find_reference_border(const SegmentIndex& index, const Point& point,
+                                    const int* containers, int count, NearestQueue* queue) {
+    if (count > 0) {
+        return find_nearest_polygon(index, point, containers, count, queue);
+    }
+    return find_nearest_polygon(index, point, queue);
+}
+
+} // namespace polygonpoint
@@ -0,0 +1,69 @@
+#ifndef NEAREST_H
+#define NEAREST_H
+
+#include <utility>
+#include <vector>
+#include "arena.h"
+#include "geometry.h"
+
+namespace polygonpoint {
+
+// aresta indexada, com o id do poligono a que pertence
+struct SegmentEntry {
+    Point p, q;
+    BoundingBox box;
+    int polygon_id;
+};
+
+// no da R-tree. os filhos de um no sao contiguos:
+// folha -> segments[first .. first + count), interno -> nodes[first .. first + count)
+struct RTreeNode {
+    BoundingBox box;
+    int first;
+    int count;
+    bool leaf;
+};
+
+// R-tree estatica (empacotada por STR) sobre as arestas de todos os poligonos indexados
+struct SegmentIndex {
+    ArenaVector<SegmentEntry> segments;
+    ArenaVector<RTreeNode> nodes;
+    int root = -1; // -1 se nao ha arestas
+};
+
+// fila de prioridade da busca (distancia ate a caixa, indice do no), reaproveitavel
+// entre consultas para nao alocar a cada ponto
+typedef std::vector<std::pair<double, int>> NearestQueue;
+
+// resultado de uma consulta de vizinho mais proximo
+struct NearestResult {
+    int polygon_id;   // 0 se o indice esta vazio
+    double distance2; // distancia ao quadrado ate a borda mais proxima
+};
+
+// constroi o indice com as arestas (contorno e furos) dos poligonos que podem conter pontos;
+// com arena, nos, arestas e temporarios da construcao ficam nela
+SegmentIndex build_segment_index(const std::vector<Polygon>& polygons, FillRule rule,
+                                 Arena* arena = nullptr);
+
+// distancia ao quadrado entre o ponto e o segmento ab
+double segment_distance2(const Point& point, const Point& a, const Point& b);
+
+// poligono com a borda mais proxima do ponto (empate: menor id);
+// queue e um buffer reaproveitado entre consultas (nullptr: fila local)
+NearestResult find_nearest_polygon(const SegmentIndex& index, const Point& point,
+                                   NearestQueue* queue = nullptr);
+
+// mesma busca, aceitando apenas arestas dos poligonos ids[0 .. count) (ids indexados em 1)
+NearestResult find_nearest_polygon(const SegmentIndex& index, const Point& point,
+                                   const int* ids, int count, NearestQueue* queue = nullptr);
+
+// referencia de distancia do ponto: a borda mais proxima entre os poligonos que o contem
+// (containers, que pode trazer so o mais interno) ou, se count == 0, o poligono mais proximo
+NearestResult find_reference_border(const SegmentIndex& index, const Point& point,
+                                    const int* containers, int count,
+                                    NearestQueue* queue = nullptr);
+
+} // namespace polygonpoint
+
+#endif // NEAREST_H
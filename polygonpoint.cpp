@@ -0,0 +1,389 @@
+#include <algorithm>
+#include <istream>
+#include <new>
+#include <streambuf>
+#include <vector>
+#include "polygonpoint.h"
+#include "arena.h"
+#include "geometry.h"
+#include "hierarchy.h"
+#include "relations.h"
+#include "nearest.h"
+
+using namespace polygonpoint;
+
+// estado de um engine: poligonos classificados e indices opcionais.
+// os indices moram na arena; poligonos e buffers de consulta sao reaproveitados
+// (mantendo a capacidade) de um lote para o outro.
+struct pp_engine {
+    std::vector<Polygon> polygons;
+    std::vector<Polygon> spare_polygons; // poligonos fora de uso, com os vetores ainda alocados
+    std::vector<std::vector<Point>> spare_holes; // aneis de furos fora de uso, idem
+    FillRule rule = FillRule::EVEN_ODD;
+
+    Arena arena;
+
+    ContainmentHierarchy hierarchy;
+    bool has_hierarchy = false;
+
+    SegmentIndex edges;
+    bool has_edges = false;
+
+    // buffers das consultas (mutable: consultas recebem o engine como const)
+    mutable NearestQueue nearest_queue;
+    mutable RelationScratch relation_scratch;
+    mutable std::vector<PolygonPair> pairs;
+};
+
+namespace {
+
+// streambuf somente leitura sobre um buffer de memoria, sem copiar o texto
+struct MemoryBuffer : std::streambuf {
+    MemoryBuffer(const char* data, size_t length) {
+        char* begin = const_cast<char*>(data);
+        setg(begin, begin, begin + length);
+    }
+};
+
+} // namespace
+
+static Point to_point(const pp_point& p) {
+    return {static_cast<long long>(p.x), static_cast<long long>(p.y)};
+}
+
+// ajusta o numero de poligonos sem destruir nenhum: os excedentes vao para o pool
+// (levando seus vetores de vertices) e voltam de la quando o proximo lote crescer
+static void resize_polygons(pp_engine* engine, size_t count) {
+    std::vector<Polygon>& polygons = engine->polygons;
+    std::vector<Polygon>& spare = engine->spare_polygons;
+
+    while (polygons.size() > count) {
+        spare.push_back(std::move(polygons.back()));
+        polygons.pop_back();
+    }
+    while (polygons.size() < count && !spare.empty()) {
+        polygons.push_back(std::move(spare.back()));
+        spare.pop_back();
+    }
+    polygons.resize(count);
+}
+
+// indices dependem dos poligonos e da regra; qualquer mudanca os invalida.
+// como so os indices usam a arena, ela e liberada inteira junto com eles
+static void drop_indexes(pp_engine* engine) {
+    engine->hierarchy = ContainmentHierarchy();
+    engine->has_hierarchy = false;
+    engine->edges = SegmentIndex();
+    engine->has_edges = false;
+    engine->arena.reset();
+}
+
+extern "C" {
+
+int pp_api_version(void) {
+    return PP_API_VERSION;
+}
+
+const char* pp_status_string(int status) {
+    switch (status) {
+        case PP_OK:
+            return "ok";
+        case PP_ERR_ARGUMENT:
+            return "argumento invalido";
+        case PP_ERR_PARSE:
+            return "erro de formato no buffer de texto";
+        case PP_ERR_NO_INDEX:
+            return "indice nao construido";
+        case PP_ERR_BUFFER:
+            return "buffer de saida insuficiente";
+        case PP_ERR_MEMORY:
+            return "memoria insuficiente";
+        default:
+            return "desconhecido";
+    }
+}
+
+pp_engine* pp_engine_create(void) {
+    return new (std::nothrow) pp_engine();
+}
+
+void pp_engine_destroy(pp_engine* engine) {
+    delete engine;
+}
+
+int pp_engine_reset(pp_engine* engine) {
+    if (!engine) {
+        return PP_ERR_ARGUMENT;
+    }
+
+    drop_indexes(engine);
+    resize_polygons(engine, 0);
+    return PP_OK;
+}
+
+int pp_get_memory_stats(const pp_engine* engine, pp_memory_stats* stats) {
+    if (!engine || !stats) {
+        return PP_ERR_ARGUMENT;
+    }
+
+    stats->arena_in_use = engine->arena.used();
+    stats->arena_high_water = engine->arena.high_water();
+    stats->arena_capacity = engine->arena.capacity();
+    stats->arena_blocks = engine->arena.block_count();
+    return PP_OK;
+}
+
+int pp_set_fill_rule(pp_engine* engine, int rule) {
+    if (!engine || (rule != PP_FILL_EVEN_ODD && rule != PP_FILL_NONZERO)) {
+        return PP_ERR_ARGUMENT;
+    }
+
+    engine->rule = (rule == PP_FILL_NONZERO) ? FillRule::NONZERO : FillRule::EVEN_ODD;
+    drop_indexes(engine);
+    return PP_OK;
+}
+
+int pp_load_polygons(pp_engine* engine, size_t polygon_count,
+                     const int32_t* ring_counts, const int32_t* ring_sizes,
+                     const pp_point* vertices) {
+    if (!engine || (polygon_count > 0 && (!ring_sizes || !vertices))) {
+        return PP_ERR_ARGUMENT;
+    }
+
+    // validar antes de tocar nos poligonos do engine
+    size_t ring = 0;
+    for (size_t i = 0; i < polygon_count; ++i) {
+        int32_t rings = ring_counts ? ring_counts[i] : 1;
+        if (rings < 1) {
+            return PP_ERR_ARGUMENT; // todo poligono tem ao menos o contorno
+        }
+        for (int32_t r = 0; r < rings; ++r, ++ring) {
+            if (ring_sizes[ring] < 0) {
+                return PP_ERR_ARGUMENT;
+            }
+        }
+    }
+
+    try {
+        drop_indexes(engine);
+
+        // preencher os poligonos existentes, reaproveitando os vetores
+        resize_polygons(engine, polygon_count);
+        std::vector<Polygon>& polygons = engine->polygons;
+        ring = 0;
+        size_t vertex = 0;
+
+        for (size_t i = 0; i < polygon_count; ++i) {
+            int32_t rings = ring_counts ? ring_counts[i] : 1;
+            Polygon& polygon = polygons[i];
+            polygon.id = i + 1;
+            resize_holes(polygon, rings - 1, &engine->spare_holes);
+
+            for (int32_t r = 0; r < rings; ++r, ++ring) {
+                std::vector<Point>& points = (r == 0) ? polygon.vertices : polygon.holes[r - 1];
+                points.resize(ring_sizes[ring]);
+                for (Point& p : points) {
+                    p = to_point(vertices[vertex++]);
+                }
+            }
+        }
+
+        classify_polygons(polygons);
+    } catch (const std::bad_alloc&) {
+        resize_polygons(engine, 0);
+        return PP_ERR_MEMORY;
+    }
+
+    return PP_OK;
+}
+
+int pp_load_polygons_text(pp_engine* engine, const char* buffer, size_t length, int with_holes) {
+    if (!engine || (!buffer && length > 0)) {
+        return PP_ERR_ARGUMENT;
+    }
+
+    try {
+        MemoryBuffer memory(buffer, length);
+        std::istream in(&memory);
+
+        int count = 0;
+        if (!(in >> count) || count < 0) {
+            return PP_ERR_PARSE;
+        }
+
+        // traz do pool no maximo um poligono por byte restante (cada um ocupa ao menos
+        // um digito); uma contagem maior que o buffer falha na leitura sem alocar
+        drop_indexes(engine);
+        resize_polygons(engine, std::min(static_cast<size_t>(count), length));
+
+        read_polygons(in, count, with_holes != 0, engine->polygons, &engine->spare_holes);
+        if (in.fail()) {
+            resize_polygons(engine, 0);
+            return PP_ERR_PARSE;
+        }
+
+        classify_polygons(engine->polygons);
+    } catch (const std::bad_alloc&) {
+        resize_polygons(engine, 0);
+        return PP_ERR_MEMORY;
+    }
+
+    return PP_OK;
+}
+
+size_t pp_polygon_count(const pp_engine* engine) {
+    return engine ? engine->polygons.size() : 0;
+}
+
+int pp_polygon_types(const pp_engine* engine, int32_t* types) {
+    if (!engine || (!types && !engine->polygons.empty())) {
+        return PP_ERR_ARGUMENT;
+    }
+
+    for (size_t i = 0; i < engine->polygons.size(); ++i) {
+        switch (engine->polygons[i].type) {
+            case PolygonType::SIMPLE_CONVEX:
+                types[i] = PP_SIMPLE_CONVEX;
+                break;
+            case PolygonType::SIMPLE_NON_CONVEX:
+                types[i] = PP_SIMPLE_NON_CONVEX;
+                break;
+            default:
+                types[i] = PP_NOT_SIMPLE;
+                break;
+        }
+    }
+
+    return PP_OK;
+}
+
+int pp_build_indexes(pp_engine* engine, unsigned flags) {
+    if (!engine || (flags & ~static_cast<unsigned>(PP_INDEX_HIERARCHY | PP_INDEX_EDGES))) {
+        return PP_ERR_ARGUMENT;
+    }
+
+    try {
+        // reconstruir um indice descarta os dois, para liberar a arena de uma vez
+        if (((flags & PP_INDEX_HIERARCHY) && engine->has_hierarchy) ||
+            ((flags & PP_INDEX_EDGES) && engine->has_edges)) {
+            bool keep_hierarchy = engine->has_hierarchy;
+            bool keep_edges = engine->has_edges;
+            drop_indexes(engine);
+            flags |= (keep_hierarchy ? PP_INDEX_HIERARCHY : 0) | (keep_edges ? PP_INDEX_EDGES : 0);
+        }
+
+        if (flags & PP_INDEX_HIERARCHY) {
+            engine->hierarchy = build_hierarchy(engine->polygons, engine->rule, &engine->arena);
+            engine->has_hierarchy = true;
+        }
+        if (flags & PP_INDEX_EDGES) {
+            engine->edges = build_segment_index(engine->polygons, engine->rule, &engine->arena);
+            engine->has_edges = true;
+        }
+    } catch (const std::bad_alloc&) {
+        return PP_ERR_MEMORY;
+    }
+
+    return PP_OK;
+}
+
+int pp_query_contains(const pp_engine* engine, const pp_point* points, size_t count,
+                      int32_t* offsets, int32_t* ids, size_t ids_capacity,
+                      size_t* ids_written) {
+    if (!engine || !offsets || !ids_written || (count > 0 && !points) ||
+        (ids_capacity > 0 && !ids)) {
+        return PP_ERR_ARGUMENT;
+    }
+
+    // ids alem da capacidade sao apenas contados, para informar o tamanho necessario
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i) {
+        offsets[i] = static_cast<int32_t>(written);
+        Point point = to_point(points[i]);
+
+        for (const Polygon& polygon : engine->polygons) {
+            if (contains(point, polygon, engine->rule)) {
+                if (written < ids_capacity) {
+                    ids[written] = polygon.id;
+                }
+                ++written;
+            }
+        }
+    }
+    offsets[count] = static_cast<int32_t>(written);
+
+    *ids_written = written;
+    return (written > ids_capacity) ? PP_ERR_BUFFER : PP_OK;
+}
+
+int pp_query_innermost(const pp_engine* engine, const pp_point* points, size_t count,
+                       int32_t* ids) {
+    if (!engine || (count > 0 && (!points || !ids))) {
+        return PP_ERR_ARGUMENT;
+    }
+    if (!engine->has_hierarchy) {
+        return PP_ERR_NO_INDEX;
+    }
+
+    // a descida na hierarquia nao aloca
+    for (size_t i = 0; i < count; ++i) {
+        ids[i] = find_innermost_polygon(engine->hierarchy, engine->polygons, to_point(points[i]));
+    }
+
+    return PP_OK;
+}
+
+int pp_query_nearest(const pp_engine* engine, const pp_point* points, size_t count,
+                     int32_t* ids, double* distance2) {
+    if (!engine || (count > 0 && (!points || !ids || !distance2))) {
+        return PP_ERR_ARGUMENT;
+    }
+    if (!engine->has_edges || !engine->has_hierarchy) {
+        return PP_ERR_NO_INDEX;
+    }
+
+    // a fila da busca nas arestas pode crescer
+    try {
+        for (size_t i = 0; i < count; ++i) {
+            Point point = to_point(points[i]);
+
+            // pontos contidos medem ate a borda do mais interno, achado na hierarquia
+            int innermost = find_innermost_polygon(engine->hierarchy, engine->polygons, point);
+            NearestResult nearest = find_reference_border(engine->edges, point, &innermost,
+                                                          innermost != 0 ? 1 : 0,
+                                                          &engine->nearest_queue);
+            ids[i] = nearest.polygon_id;
+            distance2[i] = nearest.distance2;
+        }
+    } catch (const std::bad_alloc&) {
+        return PP_ERR_MEMORY;
+    }
+
+    return PP_OK;
+}
+
+int pp_query_relations(const pp_engine* engine, pp_pair* pairs, size_t capacity,
+                       size_t* pairs_written) {
+    if (!engine || !pairs_written || (capacity > 0 && !pairs)) {
+        return PP_ERR_ARGUMENT;
+    }
+
+    try {
+        std::vector<PolygonPair>& found = engine->pairs;
+        find_polygon_relations(engine->polygons, engine->rule, found, engine->relation_scratch);
+
+        for (size_t i = 0; i < found.size() && i < capacity; ++i) {
+            pairs[i].first_id = found[i].first_id;
+            pairs[i].second_id = found[i].second_id;
+            // PP_RELATION_* segue a ordem de PolygonRelation
+            pairs[i].relation = static_cast<int32_t>(found[i].relation);
+        }
+
+        *pairs_written = found.size();
+        return (found.size() > capacity) ? PP_ERR_BUFFER : PP_OK;
+    } catch (const std::bad_alloc&) {
+        return PP_ERR_MEMORY;
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,159 @@
+#ifndef POLYGONPOINT_H
+#define POLYGONPOINT_H
+
+/*
+ * libpolygonpoint: API C estavel sobre o motor geometrico.
+ *
+ * todas as funcoes devolvem PP_OK (0) ou um codigo de erro negativo; resultados
+ * sao escritos em buffers fornecidos por quem chama, e a biblioteca nunca devolve
+ * memoria que precise ser liberada fora de pp_engine_destroy. ids de poligonos
+ * comecam em 1, como na saida do executavel; 0 significa "nenhum".
+ *
+ * um pp_engine nao e thread-safe; consultas concorrentes exigem um engine por thread.
+ *
+ * uso em lotes: indices ficam numa arena do engine, e poligonos e buffers internos
+ * mantem a capacidade entre carregamentos. depois do primeiro lote, lotes que nao
+ * crescem (mesmo numero de poligonos, vertices e arestas) nao alocam memoria.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__GNUC__)
+#define PP_API __attribute__((visibility("default")))
+#else
+#define PP_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PP_API_VERSION 1
+
+typedef struct pp_engine pp_engine;
+
+typedef struct {
+    int64_t x, y;
+} pp_point;
+
+/* uso de memoria da arena de indices, em bytes */
+typedef struct {
+    size_t arena_in_use;      /* desde o ultimo reset, com alinhamento e sobras de blocos */
+    size_t arena_high_water;  /* maior uso desde a criacao do engine */
+    size_t arena_capacity;    /* reservado */
+    size_t arena_blocks;
+} pp_memory_stats;
+
+/* relacao entre dois poligonos (first_id < second_id) */
+typedef struct {
+    int32_t first_id;
+    int32_t second_id;
+    int32_t relation; /* PP_RELATION_* */
+} pp_pair;
+
+enum {
+    PP_OK = 0,
+    PP_ERR_ARGUMENT = -1,  /* ponteiro nulo ou valor fora da faixa */
+    PP_ERR_PARSE = -2,     /* buffer de texto mal formado */
+    PP_ERR_NO_INDEX = -3,  /* consulta exige um indice que nao foi construido */
+    PP_ERR_BUFFER = -4,    /* buffer de saida pequeno; o tamanho necessario e informado */
+    PP_ERR_MEMORY = -5
+};
+
+enum {
+    PP_FILL_EVEN_ODD = 0,  /* paridade: apenas poligonos simples contem pontos */
+    PP_FILL_NONZERO = 1    /* numero de voltas diferente de zero */
+};
+
+enum {
+    PP_NOT_SIMPLE = 0,
+    PP_SIMPLE_CONVEX = 1,
+    PP_SIMPLE_NON_CONVEX = 2
+};
+
+enum {
+    PP_RELATION_DISJOINT = 0,
+    PP_RELATION_INTERSECT = 1,
+    PP_RELATION_CONTAINS = 2,
+    PP_RELATION_CONTAINED = 3
+};
+
+/* indices para pp_build_indexes */
+enum {
+    PP_INDEX_HIERARCHY = 1,  /* hierarquia de contencao (pp_query_innermost) */
+    PP_INDEX_EDGES = 2       /* R-tree de arestas (pp_query_nearest, junto com a hierarquia) */
+};
+
+PP_API int pp_api_version(void);
+PP_API const char* pp_status_string(int status);
+
+PP_API pp_engine* pp_engine_create(void);
+PP_API void pp_engine_destroy(pp_engine* engine);
+
+/* descarta poligonos e indices sem devolver memoria, preparando o proximo lote */
+PP_API int pp_engine_reset(pp_engine* engine);
+
+PP_API int pp_get_memory_stats(const pp_engine* engine, pp_memory_stats* stats);
+
+/* muda a regra de preenchimento; descarta os indices ja construidos */
+PP_API int pp_set_fill_rule(pp_engine* engine, int rule);
+
+/*
+ * carrega poligonos a partir de arrays. cada poligono tem ring_counts[i] aneis
+ * (o primeiro e o contorno, os demais sao furos; ring_counts NULL = um anel cada),
+ * ring_sizes traz o numero de vertices de cada anel e vertices os aneis em sequencia.
+ * substitui os poligonos anteriores (descartando os indices) e ja os classifica.
+ */
+PP_API int pp_load_polygons(pp_engine* engine, size_t polygon_count,
+                            const int32_t* ring_counts, const int32_t* ring_sizes,
+                            const pp_point* vertices);
+
+/*
+ * carrega poligonos de um buffer de texto: numero de poligonos seguido dos poligonos
+ * no formato de entrada do executavel (com with_holes, como na opcao --furos)
+ */
+PP_API int pp_load_polygons_text(pp_engine* engine, const char* buffer, size_t length,
+                                 int with_holes);
+
+PP_API size_t pp_polygon_count(const pp_engine* engine);
+
+/* tipo (PP_NOT_SIMPLE, ...) de cada poligono; types precisa de pp_polygon_count posicoes */
+PP_API int pp_polygon_types(const pp_engine* engine, int32_t* types);
+
+/* constroi os indices pedidos (combinacao de PP_INDEX_*); reconstruir um indice existente
+   reconstroi tambem o outro, ja que a arena e liberada de uma vez */
+PP_API int pp_build_indexes(pp_engine* engine, unsigned flags);
+
+/*
+ * poligonos que contem cada ponto, em formato CSR: os ids do ponto i ficam em
+ * ids[offsets[i] .. offsets[i + 1]). offsets precisa de count + 1 posicoes.
+ * *ids_written recebe o total de ids; se passar de ids_capacity, devolve
+ * PP_ERR_BUFFER e *ids_written e o tamanho necessario.
+ */
+PP_API int pp_query_contains(const pp_engine* engine, const pp_point* points, size_t count,
+                             int32_t* offsets, int32_t* ids, size_t ids_capacity,
+                             size_t* ids_written);
+
+/* poligono mais interno de cada ponto (exige PP_INDEX_HIERARCHY) */
+PP_API int pp_query_innermost(const pp_engine* engine, const pp_point* points, size_t count,
+                              int32_t* ids);
+
+/*
+ * distancia ao quadrado ate a borda de referencia de cada ponto (exige PP_INDEX_EDGES e
+ * PP_INDEX_HIERARCHY): para pontos contidos, a borda do poligono mais interno que os
+ * contem, achado na hierarquia; para os demais, a do poligono mais proximo. as duas
+ * buscas sao feitas na R-tree, sem testar a contencao em todos os poligonos
+ */
+PP_API int pp_query_nearest(const pp_engine* engine, const pp_point* points, size_t count,
+                            int32_t* ids, double* distance2);
+
+/* pares de poligonos nao disjuntos; mesma convencao de capacidade de pp_query_contains */
+PP_API int pp_query_relations(const pp_engine* engine, pp_pair* pairs, size_t capacity,
+                              size_t* pairs_written);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POLYGONPOINT_H */
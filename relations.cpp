@@ -0,0 +1,410 @@
+#include <algorithm>
+#include "relations.h"
+
+namespace polygonpoint {
+
+// adiciona as arestas de um anel que tocam a regiao de interesse (clip)
+static void collect_edges(const std::vector<Point>& ring, int owner, const BoundingBox& clip,
+                          std::vector<SweepEdge>& edges) {
+    const int n = ring.size();
+
+    for (int i = 0; i < n; ++i) {
+        SweepEdge edge;
+        edge.p = ring[i];
+        edge.q = ring[(i + 1) % n];
+        edge.box = {std::min(edge.p.x, edge.q.x), std::min(edge.p.y, edge.q.y),
+                    std::max(edge.p.x, edge.q.x), std::max(edge.p.y, edge.q.y)};
+        edge.owner = owner;
+
+        // arestas fora da sobreposicao das caixas nao podem cruzar o outro poligono
+        if (boxes_overlap(edge.box, clip)) {
+            edges.push_back(edge);
+        }
+    }
+}
+
+// caixa delimitadora de todos os aneis; furos invalidos podem ficar fora do contorno
+static BoundingBox polygon_bounds(const Polygon& polygon) {
+    BoundingBox box = ring_bounds(polygon.vertices);
+    for (const auto& hole : polygon.holes) {
+        if (hole.empty()) {
+            continue;
+        }
+        BoundingBox hole_box = ring_bounds(hole);
+        box.min_x = std::min(box.min_x, hole_box.min_x);
+        box.min_y = std::min(box.min_y, hole_box.min_y);
+        box.max_x = std::max(box.max_x, hole_box.max_x);
+        box.max_y = std::max(box.max_y, hole_box.max_y);
+    }
+    return box;
+}
+
+static void collect_polygon_edges(const Polygon& polygon, int owner, const BoundingBox& clip,
+                                  std::vector<SweepEdge>& edges) {
+    collect_edges(polygon.vertices, owner, clip, edges);
+    for (const auto& hole : polygon.holes) {
+        collect_edges(hole, owner, clip, edges);
+    }
+}
+
+// cruzamento proprio: cada segmento tem os extremos do outro estritamente em lados opostos
+static bool segments_cross(const Point& p1, const Point& q1, const Point& p2, const Point& q2) {
+    Orientation o1 = orientation(p1, q1, p2);
+    Orientation o2 = orientation(p1, q1, q2);
+    Orientation o3 = orientation(p2, q2, p1);
+    Orientation o4 = orientation(p2, q2, q1);
+
+    return o1 != Orientation::COLINEAR && o2 != Orientation::COLINEAR &&
+           o3 != Orientation::COLINEAR && o4 != Orientation::COLINEAR &&
+           o1 != o2 && o3 != o4;
+}
+
+/**
+ * classifica o contato entre as bordas de dois poligonos
+ *
+ * varredura em x: as arestas dos dois poligonos sao ordenadas pelo menor x e cada uma
+ * e comparada (via do_intersect) apenas com as arestas ativas do outro poligono, ou seja,
+ * aquelas cujo intervalo em x ainda alcanca a aresta atual e cujo intervalo em y se sobrepoe.
+ * considera contorno externo e furos. sem cruzamento proprio, todo ponto comum as bordas
+ * e um vertice de um dos poligonos.
+ *
+ * @return NONE, TOUCH (so vertices ou trechos colineares em comum) ou CROSS
+ */
+BorderContact border_contact(const Polygon& a, const Polygon& b, RelationScratch* scratch) {
+    if (a.vertices.empty() || b.vertices.empty()) {
+        return BorderContact::NONE;
+    }
+
+    BoundingBox box_a = polygon_bounds(a);
+    BoundingBox box_b = polygon_bounds(b);
+    if (!boxes_overlap(box_a, box_b)) {
+        return BorderContact::NONE;
+    }
+
+    // regiao comum as duas caixas
+    BoundingBox clip = {std::max(box_a.min_x, box_b.min_x), std::max(box_a.min_y, box_b.min_y),
+                        std::min(box_a.max_x, box_b.max_x), std::min(box_a.max_y, box_b.max_y)};
+
+    RelationScratch local_scratch;
+    RelationScratch& buffers = scratch ? *scratch : local_scratch;
+
+    std::vector<SweepEdge>& edges = buffers.edges;
+    edges.clear();
+    collect_polygon_edges(a, 0, clip, edges);
+    collect_polygon_edges(b, 1, clip, edges);
+
+    std::sort(edges.begin(), edges.end(), [](const SweepEdge& e1, const SweepEdge& e2) {
+        return e1.box.min_x < e2.box.min_x;
+    });
+
+    // arestas ativas de cada poligono
+    std::vector<const SweepEdge*>* active = buffers.active_edges;
+    active[0].clear();
+    active[1].clear();
+
+    BorderContact contact = BorderContact::NONE;
+    for (const SweepEdge& edge : edges) {
+        // remover arestas que terminam antes do inicio da aresta atual
+        for (int owner = 0; owner < 2; ++owner) {
+            std::vector<const SweepEdge*>& list = active[owner];
+            list.erase(std::remove_if(list.begin(), list.end(), [&edge](const SweepEdge* e) {
+                return e->box.max_x < edge.box.min_x;
+            }), list.end());
+        }
+
+        for (const SweepEdge* other : active[1 - edge.owner]) {
+            if (other->box.min_y <= edge.box.max_y && edge.box.min_y <= other->box.max_y &&
+                do_intersect(edge.p, edge.q, other->p, other->q)) {
+                if (segments_cross(edge.p, edge.q, other->p, other->q)) {
+                    return BorderContact::CROSS;
+                }
+                contact = BorderContact::TOUCH; // continua procurando um cruzamento
+            }
+        }
+
+        active[edge.owner].push_back(&edge);
+    }
+
+    return contact;
+}
+
+// bordas que apenas se tocam tambem contam como intersecao
+bool boundaries_intersect(const Polygon& a, const Polygon& b, RelationScratch* scratch) {
+    return border_contact(a, b, scratch) != BorderContact::NONE;
+}
+
+// sem bordas se tocando, cada anel de um poligono fica inteiro dentro ou inteiro fora da
+// regiao do outro, e um vertice por anel basta nos testes abaixo
+
+// verifica se algum furo de container fica dentro de inner
+static bool encloses_hole(const Polygon& inner, const Polygon& container, FillRule rule) {
+    for (const auto& hole : container.holes) {
+        if (!hole.empty() && contains(hole[0], inner, rule)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// conta os aneis nao vazios de inner (contorno e furos) e quantos estao dentro de container
+static void rings_inside(const Polygon& inner, const Polygon& container, FillRule rule,
+                         int& rings, int& inside) {
+    rings = 1;
+    inside = contains(inner.vertices[0], container, rule) ? 1 : 0;
+
+    for (const auto& hole : inner.holes) {
+        if (!hole.empty()) {
+            ++rings;
+            inside += contains(hole[0], container, rule) ? 1 : 0;
+        }
+    }
+}
+
+// trechos da borda de um poligono fora da regiao de outro e estritamente dentro dela
+struct BorderPieces {
+    bool outside = false;
+    bool inside = false;
+};
+
+// ponto racional (point / scale) sobre a borda (contorno ou furo) do poligono
+static bool on_border_scaled(const Point& point, long long scale, const Polygon& polygon) {
+    if (on_ring_border_scaled(point, scale, polygon.vertices)) {
+        return true;
+    }
+    for (const auto& hole : polygon.holes) {
+        if (on_ring_border_scaled(point, scale, hole)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * classifica os trechos das arestas de um anel em relacao a regiao de container
+ *
+ * sem cruzamento proprio entre as bordas, uma aresta so encontra a borda de container
+ * nos seus extremos e nos vertices de container que caem sobre ela. cortada nesses
+ * vertices, cada trecho fica inteiro sobre a borda, dentro ou fora de container, e o
+ * ponto medio (coordenadas racionais com denominador 2) decide qual dos tres.
+ */
+static void ring_pieces(const std::vector<Point>& ring, const Polygon& container, FillRule rule,
+                        std::vector<Point>& splits, BorderPieces& pieces) {
+    const int n = ring.size();
+
+    for (int i = 0; i < n; ++i) {
+        const Point& p = ring[i];
+        const Point& q = ring[(i + 1) % n];
+
+        // vertices de container no interior da aresta pq
+        splits.clear();
+        auto collect = [&](const std::vector<Point>& other) {
+            for (const Point& v : other) {
+                if (!(v.x == p.x && v.y == p.y) && !(v.x == q.x && v.y == q.y) &&
+                    orientation(p, v, q) == Orientation::COLINEAR && on_segment(p, v, q)) {
+                    splits.push_back(v);
+                }
+            }
+        };
+        collect(container.vertices);
+        for (const auto& hole : container.holes) {
+            collect(hole);
+        }
+
+        // ordenar a partir de p (pela coordenada que varia ao longo da aresta)
+        const bool by_x = p.x != q.x;
+        const bool ascending = by_x ? p.x < q.x : p.y < q.y;
+        std::sort(splits.begin(), splits.end(), [&](const Point& s, const Point& t) {
+            long long ks = by_x ? s.x : s.y;
+            long long kt = by_x ? t.x : t.y;
+            return ascending ? ks < kt : ks > kt;
+        });
+        splits.push_back(q);
+
+        Point start = p;
+        for (const Point& end : splits) {
+            const Point middle = {start.x + end.x, start.y + end.y}; // escalado por 2
+            if (!on_border_scaled(middle, 2, container)) {
+                if (contains_scaled(middle, 2, container, rule)) {
+                    pieces.inside = true;
+                } else {
+                    pieces.outside = true;
+                }
+            }
+            start = end;
+        }
+    }
+}
+
+// trechos da borda (contorno e furos) de inner em relacao a regiao de container
+static BorderPieces border_pieces(const Polygon& inner, const Polygon& container, FillRule rule,
+                                  std::vector<Point>& splits) {
+    BorderPieces pieces;
+    ring_pieces(inner.vertices, container, rule, splits, pieces);
+    for (const auto& hole : inner.holes) {
+        ring_pieces(hole, container, rule, splits, pieces);
+    }
+    return pieces;
+}
+
+// encloses_hole com bordas que se tocam: o vertice do furo pode estar na borda de inner,
+// entao o teste usa um ponto estritamente interior ao furo
+static bool encloses_hole_interior(const Polygon& inner, const Polygon& container, FillRule rule) {
+    for (const auto& hole : container.holes) {
+        if (ring_area2(hole) != 0 &&
+            contains_scaled(interior_point(hole, {}), INTERIOR_SCALE, inner, rule)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * relacao entre dois poligonos simples cujas bordas se tocam sem se cruzar
+ *
+ * b esta contido em a se nenhum trecho da borda de b sai de a e nenhum furo de a fica
+ * dentro de b. sem aninhamento, os interiores se sobrepoem se e somente se algum trecho
+ * de uma borda passa estritamente por dentro do outro poligono.
+ */
+static PolygonRelation classify_touching(const Polygon& a, const Polygon& b, FillRule rule,
+                                         std::vector<Point>& splits) {
+    BorderPieces b_in_a = border_pieces(b, a, rule, splits);
+    if (!b_in_a.outside && !encloses_hole_interior(b, a, rule)) {
+        return PolygonRelation::CONTAINS;
+    }
+
+    BorderPieces a_in_b = border_pieces(a, b, rule, splits);
+    if (!a_in_b.outside && !encloses_hole_interior(a, b, rule)) {
+        return PolygonRelation::CONTAINED;
+    }
+
+    if (b_in_a.inside || a_in_b.inside) {
+        return PolygonRelation::INTERSECT;
+    }
+    return PolygonRelation::DISJOINT; // so as bordas se tocam, por fora
+}
+
+/**
+ * classifica a relacao entre dois poligonos
+ *
+ * se as bordas se cruzam, os interiores se sobrepoem sem aninhamento. se apenas se tocam,
+ * os trechos de cada borda decidem (classify_touching), de modo que um poligono que
+ * compartilha arestas com o que o contem continua contido; poligonos que nao sao simples
+ * nao tem uma regiao confiavel para esse teste, e qualquer contato conta como intersecao.
+ * sem contato, cada anel esta inteiramente dentro ou fora do outro poligono, e basta
+ * testar um vertice por anel com contains (o que tambem trata um poligono dentro de um
+ * furo como disjunto). um poligono dentro do contorno do outro que envolve um furo dele
+ * se sobrepoe ao furo, e portanto intersecta o outro em vez de estar contido nele.
+ *
+ * @return relacao do ponto de vista de a (CONTAINS: a contem b)
+ */
+PolygonRelation classify_pair(const Polygon& a, const Polygon& b, FillRule rule,
+                              RelationScratch* scratch) {
+    if (a.vertices.empty() || b.vertices.empty()) {
+        return PolygonRelation::DISJOINT;
+    }
+
+    RelationScratch local_scratch;
+    RelationScratch& buffers = scratch ? *scratch : local_scratch;
+
+    BorderContact contact = border_contact(a, b, &buffers);
+    if (contact == BorderContact::CROSS) {
+        return PolygonRelation::INTERSECT;
+    }
+    if (contact == BorderContact::TOUCH) {
+        if (!a.is_simple || !b.is_simple) {
+            return PolygonRelation::INTERSECT;
+        }
+        return classify_touching(a, b, rule, buffers.splits);
+    }
+
+    int rings_b = 0, b_in_a = 0;
+    int rings_a = 0, a_in_b = 0;
+    rings_inside(b, a, rule, rings_b, b_in_a);
+    rings_inside(a, b, rule, rings_a, a_in_b);
+
+    if (b_in_a == rings_b && !encloses_hole(b, a, rule)) {
+        return PolygonRelation::CONTAINS;
+    }
+
+    if (a_in_b == rings_a && !encloses_hole(a, b, rule)) {
+        return PolygonRelation::CONTAINED;
+    }
+
+    // regioes sobrepostas sem aninhamento (um cobre o furo do outro)
+    if (b_in_a > 0 || a_in_b > 0) {
+        return PolygonRelation::INTERSECT;
+    }
+
+    return PolygonRelation::DISJOINT;
+}
+
+/**
+ * encontra a relacao entre todos os pares de poligonos
+ *
+ * uma varredura em x sobre as caixas delimitadoras gera os pares candidatos (caixas
+ * sobrepostas); pares com caixas disjuntas sao disjuntos e nunca chegam a classify_pair.
+ *
+ * @param polygons poligonos ja classificados
+ * @param rule regra de preenchimento usada nos testes de contencao
+ * @param pairs saida: pares nao disjuntos, ordenados por (first_id, second_id)
+ * @param scratch buffers das varreduras, reaproveitados entre chamadas
+ */
+void find_polygon_relations(const std::vector<Polygon>& polygons, FillRule rule,
+                            std::vector<PolygonPair>& pairs, RelationScratch& scratch) {
+    const int m = polygons.size();
+
+    std::vector<BoundingBox>& boxes = scratch.boxes;
+    std::vector<int>& order = scratch.order;
+    boxes.resize(m);
+    order.clear();
+    for (int i = 0; i < m; ++i) {
+        if (!polygons[i].vertices.empty()) {
+            boxes[i] = polygon_bounds(polygons[i]);
+            order.push_back(i);
+        }
+    }
+
+    std::sort(order.begin(), order.end(), [&boxes](int a, int b) {
+        return boxes[a].min_x < boxes[b].min_x;
+    });
+
+    std::vector<int>& active = scratch.active_polygons;
+    pairs.clear();
+    active.clear();
+
+    for (int current : order) {
+        active.erase(std::remove_if(active.begin(), active.end(), [&](int other) {
+            return boxes[other].max_x < boxes[current].min_x;
+        }), active.end());
+
+        for (int other : active) {
+            if (!boxes_overlap(boxes[current], boxes[other])) {
+                continue;
+            }
+
+            // manter o menor id primeiro
+            int first = std::min(current, other);
+            int second = std::max(current, other);
+
+            PolygonRelation relation = classify_pair(polygons[first], polygons[second], rule, &scratch);
+            if (relation != PolygonRelation::DISJOINT) {
+                pairs.push_back({polygons[first].id, polygons[second].id, relation});
+            }
+        }
+
+        active.push_back(current);
+    }
+
+    std::sort(pairs.begin(), pairs.end(), [](const PolygonPair& a, const PolygonPair& b) {
+        return (a.first_id != b.first_id) ? a.first_id < b.first_id : a.second_id < b.second_id;
+    });
+}
+
+std::vector<PolygonPair> find_polygon_relations(const std::vector<Polygon>& polygons, FillRule rule) {
+    std::vector<PolygonPair> pairs;
+    RelationScratch scratch;
+    find_polygon_relations(polygons, rule, pairs, scratch);
+    return pairs;
+}
+
+} // namespace polygonpoint
@@ -0,0 +1,84 @@
+#ifndef RELATIONS_H
+#define RELATIONS_H
+
+#include <vector>
+#include <string>
+#include "geometry.h"
+
+namespace polygonpoint {
+
+enum class PolygonRelation {
+    DISJOINT,   // "disjuntos"
+    INTERSECT,  // "intersectam" (interiores se sobrepoem sem aninhamento)
+    CONTAINS,   // "contem" (o primeiro contem o segundo)
+    CONTAINED   // "contido" (o primeiro esta contido no segundo)
+};
+
+// converter o enum para string para a saida
+inline std::string polygon_relation_to_string(PolygonRelation relation) {
+    switch (relation) {
+        case PolygonRelation::DISJOINT:
+            return "disjuntos";
+        case PolygonRelation::INTERSECT:
+            return "intersectam";
+        case PolygonRelation::CONTAINS:
+            return "contem";
+        case PolygonRelation::CONTAINED:
+            return "contido";
+        default:
+            return "desconhecido";
+    }
+}
+
+// relacao entre dois poligonos (first_id < second_id)
+struct PolygonPair {
+    int first_id;
+    int second_id;
+    PolygonRelation relation;
+};
+
+// aresta usada na varredura, com a caixa delimitadora ja calculada
+struct SweepEdge {
+    Point p, q;
+    BoundingBox box;
+    int owner; // 0 para o primeiro poligono, 1 para o segundo
+};
+
+// contato entre as bordas de dois poligonos
+enum class BorderContact {
+    NONE,   // nenhuma aresta se encontra
+    TOUCH,  // arestas se encontram apenas em vertices ou em trechos colineares
+    CROSS   // alguma aresta cruza outra num ponto interior as duas
+};
+
+// buffers das varreduras, reaproveitados entre pares e entre chamadas
+struct RelationScratch {
+    std::vector<SweepEdge> edges;
+    std::vector<Point> splits; // vertices de um poligono sobre uma aresta do outro
+    std::vector<const SweepEdge*> active_edges[2];
+    std::vector<BoundingBox> boxes;
+    std::vector<int> order;
+    std::vector<int> active_polygons;
+};
+
+// verifica se alguma aresta (contorno ou furo) de a intersecta alguma aresta de b
+bool boundaries_intersect(const Polygon& a, const Polygon& b, RelationScratch* scratch = nullptr);
+
+// tipo de contato entre as bordas (contorno e furos) de a e b
+BorderContact border_contact(const Polygon& a, const Polygon& b, RelationScratch* scratch = nullptr);
+
+// relacao entre dois poligonos, do ponto de vista de a
+PolygonRelation classify_pair(const Polygon& a, const Polygon& b, FillRule rule,
+                              RelationScratch* scratch = nullptr);
+
+// lista esparsa das relacoes entre todos os pares de poligonos (pares disjuntos sao omitidos)
+std::vector<PolygonPair> find_polygon_relations(const std::vector<Polygon>& polygons, FillRule rule);
+
+// mesma consulta, escrevendo em pairs e usando os buffers de scratch (sem alocar quando
+// as capacidades ja bastam)
+void find_polygon_relations(const std::vector<Polygon>& polygons, FillRule rule,
+                            std::vector<PolygonPair>& pairs, RelationScratch& scratch);
+
+} // namespace polygonpoint
+
+#endif // RELATIONS_H
@@ -0,0 +1,103 @@
+// lotes estaveis nao alocam: conta as chamadas a operator new enquanto um engine
+// alterna lotes em arrays (com furo) e em texto (sem furos), do carregamento as consultas
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "polygonpoint.h"
+
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+    ++allocations;
+    void* p = std::malloc(size ? size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+static int failures = 0;
+
+#define CHECK(cond)                                                   \
+    do {                                                              \
+        if (!(cond)) {                                                \
+            std::printf("FALHOU alloc.cpp:%d: %s\n", __LINE__, #cond); \
+            ++failures;                                               \
+        }                                                             \
+    } while (0)
+
+// mesmo cenario de tests/in/default.txt, sem furos
+static const char* TEXT_POLYGONS =
+    "3\n"
+    "4\n1 4\n15 4\n15 20\n1 20\n"
+    "3\n8 12\n25 8\n25 18\n"
+    "5\n2 6\n2 1\n15 2\n20 1\n20 6\n";
+
+// quadrado 0..10 com furo 3..7 e ilha 4..6 dentro do furo
+static const int32_t RING_COUNTS[2] = {2, 1};
+static const int32_t RING_SIZES[3] = {4, 4, 4};
+static const pp_point VERTICES[12] = {
+    {0, 0}, {10, 0}, {10, 10}, {0, 10},
+    {3, 3}, {7, 3}, {7, 7}, {3, 7},
+    {4, 4}, {6, 4}, {6, 6}, {4, 6}
+};
+
+static const pp_point POINTS[4] = {{1, 1}, {5, 5}, {12, 12}, {25, 2}};
+
+// consultas de um lote; os buffers de saida sao de quem chama
+static void run_queries(pp_engine* engine) {
+    int32_t offsets[5];
+    int32_t ids[16];
+    double distance2[4];
+    pp_pair pairs[8];
+    size_t written = 0;
+
+    CHECK(pp_build_indexes(engine, PP_INDEX_HIERARCHY | PP_INDEX_EDGES) == PP_OK);
+    CHECK(pp_query_contains(engine, POINTS, 4, offsets, ids, 16, &written) == PP_OK);
+    CHECK(pp_query_innermost(engine, POINTS, 4, ids) == PP_OK);
+    CHECK(pp_query_nearest(engine, POINTS, 4, ids, distance2) == PP_OK);
+    CHECK(pp_query_relations(engine, pairs, 8, &written) == PP_OK);
+}
+
+static void run_batches(pp_engine* engine) {
+    CHECK(pp_engine_reset(engine) == PP_OK);
+    CHECK(pp_load_polygons(engine, 2, RING_COUNTS, RING_SIZES, VERTICES) == PP_OK);
+    run_queries(engine);
+
+    CHECK(pp_engine_reset(engine) == PP_OK);
+    CHECK(pp_load_polygons_text(engine, TEXT_POLYGONS, std::strlen(TEXT_POLYGONS), 0) == PP_OK);
+    run_queries(engine);
+}
+
+int main() {
+    pp_engine* engine = pp_engine_create();
+
+    // os primeiros ciclos aquecem poligonos, furos, arena e buffers das consultas
+    run_batches(engine);
+    run_batches(engine);
+
+    size_t before = allocations;
+    for (int i = 0; i < 3; ++i) {
+        run_batches(engine);
+    }
+    CHECK(allocations == before);
+    if (allocations != before) {
+        std::printf("alloc.cpp: %zu alocacoes em lotes estaveis\n", allocations - before);
+    }
+
+    pp_engine_destroy(engine);
+
+    if (failures == 0) {
+        std::printf("ok     alloc\n");
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+/* testes da API C da libpolygonpoint (compilado como C puro) */
+#include <stdio.h>
+#include <string.h>
+#include "polygonpoint.h"
+
+static int failures = 0;
+
+#define CHECK(cond)                                                   \
+    do {                                                              \
+        if (!(cond)) {                                                \
+            printf("FALHOU c_api.c:%d: %s\n", __LINE__, #cond);       \
+            ++failures;                                               \
+        }                                                             \
+    } while (0)
+
+/* mesmo cenario de tests/in/default.txt */
+static const char* DEFAULT_POLYGONS =
+    "3\n"
+    "4\n1 4\n15 4\n15 20\n1 20\n"
+    "3\n8 12\n25 8\n25 18\n"
+    "5\n2 6\n2 1\n15 2\n20 1\n20 6\n";
+
+static void test_text_and_contains(void) {
+    pp_engine* engine = pp_engine_create();
+    pp_point points[3] = {{12, 12}, {25, 2}, {5, 5}};
+    int32_t types[3];
+    int32_t offsets[4];
+    int32_t ids[8];
+    size_t written = 0;
+
+    CHECK(pp_load_polygons_text(engine, DEFAULT_POLYGONS, strlen(DEFAULT_POLYGONS), 0) == PP_OK);
+    CHECK(pp_polygon_count(engine) == 3);
+
+    CHECK(pp_polygon_types(engine, types) == PP_OK);
+    CHECK(types[0] == PP_SIMPLE_CONVEX && types[1] == PP_SIMPLE_CONVEX);
+    CHECK(types[2] == PP_SIMPLE_NON_CONVEX);
+
+    /* saida esperada: 1:1 2 / 2: / 3:1 3 */
+    CHECK(pp_query_contains(engine, points, 3, offsets, ids, 8, &written) == PP_OK);
+    CHECK(written == 4);
+    CHECK(offsets[0] == 0 && offsets[1] == 2 && offsets[2] == 2 && offsets[3] == 4);
+    CHECK(ids[0] == 1 && ids[1] == 2 && ids[2] == 1 && ids[3] == 3);
+
+    /* buffer pequeno: informa o tamanho necessario */
+    CHECK(pp_query_contains(engine, points, 3, offsets, ids, 1, &written) == PP_ERR_BUFFER);
+    CHECK(written == 4);
+
+    pp_engine_destroy(engine);
+}
+
+static void test_arrays_and_indexes(void) {
+    pp_engine* engine = pp_engine_create();
+
+    /* quadrado 0..10 com furo 3..7, ilha 4..6 dentro do furo */
+    int32_t ring_counts[2] = {2, 1};
+    int32_t ring_sizes[3] = {4, 4, 4};
+    pp_point vertices[12] = {
+        {0, 0}, {10, 0}, {10, 10}, {0, 10},
+        {3, 3}, {7, 3}, {7, 7}, {3, 7},
+        {4, 4}, {6, 4}, {6, 6}, {4, 6}
+    };
+    pp_point points[3] = {{1, 1}, {5, 5}, {20, 10}};
+    int32_t ids[3];
+    double distance2[3];
+    pp_pair pairs[4];
+    size_t written = 0;
+
+    CHECK(pp_load_polygons(engine, 2, ring_counts, ring_sizes, vertices) == PP_OK);
+
+    CHECK(pp_query_innermost(engine, points, 3, ids) == PP_ERR_NO_INDEX);
+    CHECK(pp_build_indexes(engine, PP_INDEX_HIERARCHY | PP_INDEX_EDGES) == PP_OK);
+
+    CHECK(pp_query_innermost(engine, points, 3, ids) == PP_OK);
+    CHECK(ids[0] == 1 && ids[1] == 2 && ids[2] == 0);
+
+    CHECK(pp_query_nearest(engine, points, 3, ids, distance2) == PP_OK);
+    CHECK(ids[0] == 1 && distance2[0] == 1.0);
+    CHECK(ids[1] == 2 && distance2[1] == 1.0);
+    CHECK(ids[2] == 1 && distance2[2] == 100.0);
+
+    /* a ilha esta no furo: disjuntos */
+    CHECK(pp_query_relations(engine, pairs, 4, &written) == PP_OK);
+    CHECK(written == 0);
+
+    /* indices ficam na arena; reset libera tudo e mantem o pico registrado */
+    {
+        pp_memory_stats stats;
+        size_t high_water;
+
+        CHECK(pp_get_memory_stats(engine, &stats) == PP_OK);
+        CHECK(stats.arena_in_use > 0 && stats.arena_blocks >= 1);
+        CHECK(stats.arena_high_water >= stats.arena_in_use);
+        high_water = stats.arena_high_water;
+
+        CHECK(pp_engine_reset(engine) == PP_OK);
+        CHECK(pp_polygon_count(engine) == 0);
+        CHECK(pp_get_memory_stats(engine, &stats) == PP_OK);
+        CHECK(stats.arena_in_use == 0 && stats.arena_high_water == high_water);
+        CHECK(stats.arena_blocks == 1);
+
+        /* o mesmo lote de novo usa a mesma memoria */
+        CHECK(pp_load_polygons(engine, 2, ring_counts, ring_sizes, vertices) == PP_OK);
+        CHECK(pp_build_indexes(engine, PP_INDEX_HIERARCHY | PP_INDEX_EDGES) == PP_OK);
+        CHECK(pp_get_memory_stats(engine, &stats) == PP_OK);
+        CHECK(stats.arena_high_water == high_water && stats.arena_blocks == 1);
+    }
+
+    /* mudar a regra descarta os indices */
+    CHECK(pp_set_fill_rule(engine, PP_FILL_NONZERO) == PP_OK);
+    CHECK(pp_query_nearest(engine, points, 3, ids, distance2) == PP_ERR_NO_INDEX);
+
+    /* pontos contidos usam o mais interno da hierarquia: so a R-tree nao basta */
+    CHECK(pp_build_indexes(engine, PP_INDEX_EDGES) == PP_OK);
+    CHECK(pp_query_nearest(engine, points, 3, ids, distance2) == PP_ERR_NO_INDEX);
+    CHECK(pp_build_indexes(engine, PP_INDEX_HIERARCHY) == PP_OK);
+    CHECK(pp_query_nearest(engine, points, 3, ids, distance2) == PP_OK);
+    CHECK(ids[1] == 2 && distance2[1] == 1.0);
+
+    pp_engine_destroy(engine);
+}
+
+static void test_errors(void) {
+    pp_engine* engine = pp_engine_create();
+    const char* bad = "1\n4\n0 0\n1";
+    /* contagens enormes sem dados: devem falhar na leitura, sem reservar memoria */
+    const char* huge_ring = "1\n2147483647\n";
+    const char* huge_holes = "1\n3\n0 0\n1 0\n0 1\n2147483647\n";
+    const char* huge_count = "2147483647\n3\n0 0\n1 0\n0 1\n";
+    int32_t ring_sizes[1] = {-1};
+    pp_point vertex = {0, 0};
+
+    CHECK(pp_api_version() == PP_API_VERSION);
+    CHECK(pp_load_polygons_text(engine, bad, strlen(bad), 0) == PP_ERR_PARSE);
+    CHECK(pp_load_polygons_text(engine, huge_ring, strlen(huge_ring), 0) == PP_ERR_PARSE);
+    CHECK(pp_load_polygons_text(engine, huge_holes, strlen(huge_holes), 1) == PP_ERR_PARSE);
+    CHECK(pp_load_polygons_text(engine, huge_count, strlen(huge_count), 0) == PP_ERR_PARSE);
+    CHECK(pp_polygon_count(engine) == 0);
+    CHECK(pp_load_polygons(engine, 1, NULL, ring_sizes, &vertex) == PP_ERR_ARGUMENT);
+    CHECK(pp_set_fill_rule(engine, 7) == PP_ERR_ARGUMENT);
+    CHECK(pp_set_fill_rule(NULL, PP_FILL_EVEN_ODD) == PP_ERR_ARGUMENT);
+    CHECK(strcmp(pp_status_string(PP_ERR_BUFFER), "buffer de saida insuficiente") == 0);
+
+    pp_engine_destroy(engine);
+}
+
+int main(void) {
+    test_text_and_contains();
+    test_arrays_and_indexes();
+    test_errors();
+
+    if (failures == 0) {
+        printf("ok     c_api\n");
+    }
+    return failures == 0 ? 0 : 1;
+}